@@ -21,6 +21,8 @@
     #include <dirent.h>
     #include <cstdlib>
     #include <fstream>
+    #include "src/Core/Platform/internal/ProcessLauncher.h"
+    #include "src/Core/Platform/internal/ThreadRegistry.h"
 #elif defined(__APPLE__)
     #include <unistd.h>
     #include <pwd.h>
@@ -157,6 +159,8 @@ uint32_t Exs_PlatformUtils::Exs_GetParentProcessId() {
 uint32_t Exs_PlatformUtils::Exs_GetThreadId() {
 #ifdef _WIN32
     return GetCurrentThreadId();
+#elif defined(__linux__)
+    return Internal::Platform::Exs_GetOSThreadId();
 #else
     return 0; // pthread_self() returns pthread_t, not integer
 #endif
@@ -338,6 +342,9 @@ void Exs_PlatformUtils::Exs_DumpEnvironmentVariables() {
 }
 
 int Exs_PlatformUtils::Exs_ExecuteCommand(const std::string& command, std::string* output) {
+#ifdef __linux__
+    return Exs_ExecuteCommandWithTimeout(command, 0, output);
+#else
 #ifdef _WIN32
     FILE* pipe = _popen(command.c_str(), "r");
 #else
@@ -358,13 +365,25 @@ int Exs_PlatformUtils::Exs_ExecuteCommand(const std::string& command, std::strin
 #else
     return pclose(pipe);
 #endif
+#endif
 }
 
 int Exs_PlatformUtils::Exs_ExecuteCommandWithTimeout(const std::string& command, 
                                                    uint32_t timeout_ms,
                                                    std::string* output) {
+#ifdef __linux__
+    // posix_spawn avoids copying our page tables; a timeout kills the process group.
+    // stdin and stderr are inherited as with popen()
+    Internal::Platform::Exs_ProcessResult result = 
+        Internal::Platform::Exs_RunShellCommand(command, timeout_ms, output);
+    if (!result.launched || result.timedOut) {
+        return -1;
+    }
+    return result.waitStatus;
+#else
     // Simple implementation - execute and wait
     return Exs_ExecuteCommand(command, output);
+#endif
 }
 
 std::string Exs_PlatformUtils::Exs_GetComputerName() {
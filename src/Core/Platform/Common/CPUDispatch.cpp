@@ -0,0 +1,117 @@
+// src/Core/Platform/Common/CPUDispatch.cpp
+#include "../internal/CPUDispatch.h"
+#include "../internal/PlatformDescriptor.h"
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+struct Exs_DispatchRegistration {
+    const char* name;
+    const std::atomic<uint32>* selectedTarget;
+    const std::atomic<uint32>* variantMask;
+};
+
+static std::mutex& Exs_GetDispatchRegistryMutex() {
+    static std::mutex registryMutex;
+    return registryMutex;
+}
+
+static std::vector<Exs_DispatchRegistration>& Exs_GetDispatchRegistry() {
+    static std::vector<Exs_DispatchRegistration> registry;
+    return registry;
+}
+
+static uint32 Exs_ParseDispatchCap() {
+    const char* cap = getenv("EXS_DISPATCH_MAX");
+    if (cap == nullptr || cap[0] == '\0') {
+        return static_cast<uint32>(Exs_DispatchTarget::Count);
+    }
+
+    for (uint32 index = 0; index < static_cast<uint32>(Exs_DispatchTarget::Count); index++) {
+        if (strcmp(cap, Exs_GetDispatchTargetName(static_cast<Exs_DispatchTarget>(index))) == 0) {
+            return index;
+        }
+    }
+    return static_cast<uint32>(Exs_DispatchTarget::Count);
+}
+
+static uint32 Exs_DetectSupportedTargets() {
+    const Exs_PlatformDescriptor& descriptor = Exs_GetPlatformDescriptor();
+    uint32 cap = Exs_ParseDispatchCap();
+
+    uint32 supported = 1u << static_cast<uint32>(Exs_DispatchTarget::Scalar);
+    if (descriptor.hasSSE2) {
+        supported |= 1u << static_cast<uint32>(Exs_DispatchTarget::SSE2);
+    }
+    if (descriptor.hasNEON) {
+        supported |= 1u << static_cast<uint32>(Exs_DispatchTarget::NEON);
+    }
+    if (descriptor.hasAVX2) {
+        supported |= 1u << static_cast<uint32>(Exs_DispatchTarget::AVX2);
+    }
+    if (descriptor.hasAVX512F) {
+        supported |= 1u << static_cast<uint32>(Exs_DispatchTarget::AVX512);
+    }
+
+    // Drop every target above the cap, but never the scalar fallback
+    if (cap < static_cast<uint32>(Exs_DispatchTarget::Count)) {
+        supported &= (2u << cap) - 1;
+        supported |= 1u;
+    }
+    return supported;
+}
+
+bool Exs_IsDispatchTargetSupported(Exs_DispatchTarget target) {
+    static const uint32 supportedTargets = Exs_DetectSupportedTargets();
+    return (supportedTargets & (1u << static_cast<uint32>(target))) != 0;
+}
+
+Exs_DispatchTarget Exs_GetBestDispatchTarget() {
+    for (uint32 index = static_cast<uint32>(Exs_DispatchTarget::Count); index-- > 0;) {
+        if (Exs_IsDispatchTargetSupported(static_cast<Exs_DispatchTarget>(index))) {
+            return static_cast<Exs_DispatchTarget>(index);
+        }
+    }
+    return Exs_DispatchTarget::Scalar;
+}
+
+const char* Exs_GetDispatchTargetName(Exs_DispatchTarget target) {
+    switch (target) {
+        case Exs_DispatchTarget::Scalar: return "scalar";
+        case Exs_DispatchTarget::SSE2: return "sse2";
+        case Exs_DispatchTarget::NEON: return "neon";
+        case Exs_DispatchTarget::AVX2: return "avx2";
+        case Exs_DispatchTarget::AVX512: return "avx512";
+        default: return "unknown";
+    }
+}
+
+void Exs_RegisterDispatchEntry(const char* name, const std::atomic<uint32>* selectedTarget,
+                               const std::atomic<uint32>* variantMask) {
+    std::lock_guard<std::mutex> lock(Exs_GetDispatchRegistryMutex());
+    Exs_GetDispatchRegistry().push_back({ name, selectedTarget, variantMask });
+}
+
+std::vector<Exs_DispatchEntry> Exs_GetDispatchEntries() {
+    std::lock_guard<std::mutex> lock(Exs_GetDispatchRegistryMutex());
+
+    std::vector<Exs_DispatchEntry> entries;
+    entries.reserve(Exs_GetDispatchRegistry().size());
+    for (const auto& registration : Exs_GetDispatchRegistry()) {
+        Exs_DispatchEntry entry;
+        entry.name = registration.name != nullptr ? registration.name : "";
+        entry.selectedTarget = static_cast<Exs_DispatchTarget>(
+            registration.selectedTarget->load(std::memory_order_relaxed));
+        entry.variantMask = registration.variantMask->load(std::memory_order_relaxed);
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
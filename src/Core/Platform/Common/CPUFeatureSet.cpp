@@ -0,0 +1,157 @@
+// src/Core/Platform/Common/CPUFeatureSet.cpp
+#include "../internal/CPUFeatureSet.h"
+#include "../internal/CPUID.h"
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+// Register bit -> feature for one cpuid output register
+struct Exs_CPUIDBit {
+    uint32 bit;
+    Exs_CPUFeature feature;
+};
+
+static void Exs_ApplyCPUIDBits(Exs_CPUFeatureSet& set, uint32 value, const Exs_CPUIDBit* bits, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (value & (1u << bits[i].bit)) {
+            set.set(bits[i].feature);
+        }
+    }
+}
+
+template <size_t N>
+static void Exs_ApplyCPUIDBits(Exs_CPUFeatureSet& set, uint32 value, const Exs_CPUIDBit (&bits)[N]) {
+    Exs_ApplyCPUIDBits(set, value, bits, N);
+}
+
+void Exs_DetectX86CPUFeatures(Exs_CPUFeatureSet& set) {
+    uint32 maxLeaf = Exs_GetMaxCPUIDLeaf(0);
+    if (maxLeaf < 1) {
+        return;
+    }
+
+    uint32 registers[4] = {0};
+    uint32& eax = registers[0];
+    uint32& ebx = registers[1];
+    uint32& ecx = registers[2];
+    uint32& edx = registers[3];
+
+    Exs_ReadCPUID(1, 0, registers);
+    static const Exs_CPUIDBit leaf1EDX[] = {
+        { 23, Exs_CPUFeature::MMX }, { 25, Exs_CPUFeature::SSE }, { 26, Exs_CPUFeature::SSE2 }
+    };
+    static const Exs_CPUIDBit leaf1ECX[] = {
+        { 0, Exs_CPUFeature::SSE3 }, { 1, Exs_CPUFeature::PCLMULQDQ }, { 5, Exs_CPUFeature::VMX },
+        { 9, Exs_CPUFeature::SSSE3 }, { 12, Exs_CPUFeature::FMA }, { 13, Exs_CPUFeature::CX16 },
+        { 19, Exs_CPUFeature::SSE4_1 }, { 20, Exs_CPUFeature::SSE4_2 }, { 22, Exs_CPUFeature::MOVBE },
+        { 23, Exs_CPUFeature::POPCNT }, { 25, Exs_CPUFeature::AES }, { 26, Exs_CPUFeature::XSAVE },
+        { 27, Exs_CPUFeature::OSXSAVE }, { 28, Exs_CPUFeature::AVX }, { 29, Exs_CPUFeature::F16C },
+        { 30, Exs_CPUFeature::RDRAND }, { 31, Exs_CPUFeature::HYPERVISOR }
+    };
+    Exs_ApplyCPUIDBits(set, edx, leaf1EDX);
+    Exs_ApplyCPUIDBits(set, ecx, leaf1ECX);
+
+    if (maxLeaf >= 7) {
+        Exs_ReadCPUID(7, 0, registers);
+        static const Exs_CPUIDBit leaf7EBX[] = {
+            { 0, Exs_CPUFeature::FSGSBASE }, { 2, Exs_CPUFeature::SGX }, { 3, Exs_CPUFeature::BMI1 },
+            { 4, Exs_CPUFeature::HLE }, { 5, Exs_CPUFeature::AVX2 }, { 8, Exs_CPUFeature::BMI2 },
+            { 9, Exs_CPUFeature::ERMS }, { 11, Exs_CPUFeature::RTM }, { 16, Exs_CPUFeature::AVX512F },
+            { 17, Exs_CPUFeature::AVX512DQ }, { 18, Exs_CPUFeature::RDSEED }, { 19, Exs_CPUFeature::ADX },
+            { 21, Exs_CPUFeature::AVX512IFMA }, { 23, Exs_CPUFeature::CLFLUSHOPT }, { 24, Exs_CPUFeature::CLWB },
+            { 26, Exs_CPUFeature::AVX512PF }, { 27, Exs_CPUFeature::AVX512ER }, { 28, Exs_CPUFeature::AVX512CD },
+            { 29, Exs_CPUFeature::SHA }, { 30, Exs_CPUFeature::AVX512BW }, { 31, Exs_CPUFeature::AVX512VL }
+        };
+        static const Exs_CPUIDBit leaf7ECX[] = {
+            { 1, Exs_CPUFeature::AVX512VBMI }, { 5, Exs_CPUFeature::WAITPKG }, { 6, Exs_CPUFeature::AVX512_VBMI2 },
+            { 8, Exs_CPUFeature::GFNI }, { 9, Exs_CPUFeature::VAES }, { 10, Exs_CPUFeature::VPCLMULQDQ },
+            { 11, Exs_CPUFeature::AVX512_VNNI }, { 12, Exs_CPUFeature::AVX512_BITALG },
+            { 14, Exs_CPUFeature::AVX512_VPOPCNTDQ }, { 22, Exs_CPUFeature::RDPID },
+            { 27, Exs_CPUFeature::MOVDIRI }, { 28, Exs_CPUFeature::MOVDIR64B }
+        };
+        static const Exs_CPUIDBit leaf7EDX[] = {
+            { 2, Exs_CPUFeature::AVX512_4VNNIW }, { 3, Exs_CPUFeature::AVX512_4FMAPS }, { 4, Exs_CPUFeature::FSRM },
+            { 8, Exs_CPUFeature::AVX512_VP2INTERSECT }, { 14, Exs_CPUFeature::SERIALIZE },
+            { 15, Exs_CPUFeature::HYBRID }, { 16, Exs_CPUFeature::TSXLDTRK }, { 22, Exs_CPUFeature::AMX_BF16 },
+            { 23, Exs_CPUFeature::AVX512_FP16 }, { 24, Exs_CPUFeature::AMX_TILE }, { 25, Exs_CPUFeature::AMX_INT8 }
+        };
+        Exs_ApplyCPUIDBits(set, ebx, leaf7EBX);
+        Exs_ApplyCPUIDBits(set, ecx, leaf7ECX);
+        Exs_ApplyCPUIDBits(set, edx, leaf7EDX);
+
+        if (eax >= 1) {
+            Exs_ReadCPUID(7, 1, registers);
+            static const Exs_CPUIDBit leaf71EAX[] = {
+                { 4, Exs_CPUFeature::AVX_VNNI }, { 5, Exs_CPUFeature::AVX512_BF16 }
+            };
+            Exs_ApplyCPUIDBits(set, eax, leaf71EAX);
+        }
+    }
+
+    uint32 maxExtendedLeaf = Exs_GetMaxCPUIDLeaf(0x80000000);
+    if (maxExtendedLeaf >= 0x80000001) {
+        Exs_ReadCPUID(0x80000001, 0, registers);
+        static const Exs_CPUIDBit extendedECX[] = {
+            { 0, Exs_CPUFeature::LAHF_LM }, { 2, Exs_CPUFeature::SVM }, { 5, Exs_CPUFeature::ABM },
+            { 6, Exs_CPUFeature::SSE4A }, { 8, Exs_CPUFeature::PREFETCHW }, { 11, Exs_CPUFeature::XOP },
+            { 16, Exs_CPUFeature::FMA4 }, { 21, Exs_CPUFeature::TBM }
+        };
+        static const Exs_CPUIDBit extendedEDX[] = {
+            { 20, Exs_CPUFeature::NX }, { 26, Exs_CPUFeature::PDPE1GB }, { 27, Exs_CPUFeature::RDTSCP },
+            { 29, Exs_CPUFeature::LM }
+        };
+        Exs_ApplyCPUIDBits(set, ecx, extendedECX);
+        Exs_ApplyCPUIDBits(set, edx, extendedEDX);
+    }
+    if (maxExtendedLeaf >= 0x80000007) {
+        Exs_ReadCPUID(0x80000007, 0, registers);
+        set.set(Exs_CPUFeature::INVARIANT_TSC, (edx & (1u << 8)) != 0);
+    }
+
+    // Register state the OS does not save makes the instructions unusable
+    uint64 xcr0 = set.has(Exs_CPUFeature::OSXSAVE) ? Exs_ReadXCR0() : 0;
+    bool osAVX = (xcr0 & 0x6) == 0x6;          // XMM, YMM
+    bool osAVX512 = osAVX && (xcr0 & 0xE0) == 0xE0; // opmask, ZMM_Hi256, Hi16_ZMM
+    bool osAMX = (xcr0 & 0x60000) == 0x60000;  // XTILECFG, XTILEDATA
+
+    static const Exs_CPUFeature avxFeatures[] = {
+        Exs_CPUFeature::AVX, Exs_CPUFeature::AVX2, Exs_CPUFeature::FMA, Exs_CPUFeature::F16C,
+        Exs_CPUFeature::VAES, Exs_CPUFeature::VPCLMULQDQ, Exs_CPUFeature::AVX_VNNI, Exs_CPUFeature::XOP,
+        Exs_CPUFeature::FMA4
+    };
+    static const Exs_CPUFeature avx512Features[] = {
+        Exs_CPUFeature::AVX512F, Exs_CPUFeature::AVX512DQ, Exs_CPUFeature::AVX512IFMA,
+        Exs_CPUFeature::AVX512PF, Exs_CPUFeature::AVX512ER, Exs_CPUFeature::AVX512CD,
+        Exs_CPUFeature::AVX512BW, Exs_CPUFeature::AVX512VL, Exs_CPUFeature::AVX512VBMI,
+        Exs_CPUFeature::AVX512_VBMI2, Exs_CPUFeature::AVX512_VNNI, Exs_CPUFeature::AVX512_BITALG,
+        Exs_CPUFeature::AVX512_VPOPCNTDQ, Exs_CPUFeature::AVX512_4VNNIW, Exs_CPUFeature::AVX512_4FMAPS,
+        Exs_CPUFeature::AVX512_VP2INTERSECT, Exs_CPUFeature::AVX512_FP16, Exs_CPUFeature::AVX512_BF16
+    };
+    static const Exs_CPUFeature amxFeatures[] = {
+        Exs_CPUFeature::AMX_BF16, Exs_CPUFeature::AMX_TILE, Exs_CPUFeature::AMX_INT8
+    };
+
+    if (!osAVX) {
+        for (Exs_CPUFeature feature : avxFeatures) {
+            set.set(feature, false);
+        }
+    }
+    if (!osAVX512) {
+        for (Exs_CPUFeature feature : avx512Features) {
+            set.set(feature, false);
+        }
+    }
+    // Linux additionally requires arch_prctl(ARCH_REQ_XCOMP_PERM) per process before AMX use
+    if (!osAMX) {
+        for (Exs_CPUFeature feature : amxFeatures) {
+            set.set(feature, false);
+        }
+    }
+}
+#endif
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
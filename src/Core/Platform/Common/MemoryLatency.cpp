@@ -0,0 +1,58 @@
+// src/Core/Platform/Common/MemoryLatency.cpp
+#include "../internal/MemoryLatency.h"
+#include <algorithm>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+constexpr double kExs_LatencyPlateauTolerance = 1.25;
+
+std::vector<Exs_LatencyLevel> Exs_InferLatencyLevels(const std::vector<Exs_LatencyPoint>& points) {
+    std::vector<Exs_LatencyLevel> levels;
+
+    size_t start = 0;
+    while (start < points.size()) {
+        size_t end = start + 1;
+        while (end < points.size() && points[end].nanoseconds <= points[start].nanoseconds * kExs_LatencyPlateauTolerance) {
+            end++;
+        }
+
+        // A lone point between plateaus is a partial hit, except at the end of the sweep
+        if (end - start > 1 || end == points.size()) {
+            std::vector<double> latencies;
+            for (size_t i = start; i < end; i++) {
+                latencies.push_back(points[i].nanoseconds);
+            }
+            std::nth_element(latencies.begin(), latencies.begin() + latencies.size() / 2, latencies.end());
+
+            Exs_LatencyLevel level = {};
+            level.level = static_cast<uint32>(levels.size() + 1);
+            level.capacityBytes = points[end - 1].workingSetBytes;
+            level.nanoseconds = latencies[latencies.size() / 2];
+            levels.push_back(level);
+        }
+
+        start = end;
+    }
+
+    if (levels.size() > 1) {
+        levels.back().level = kExs_LatencyMemoryLevel;
+        levels.back().capacityBytes = 0;
+    }
+    return levels;
+}
+
+double Exs_LatencyReport::getLocalMemoryNanoseconds() const {
+    for (const Exs_LatencyCurve& curve : curves) {
+        if (curve.cpuNode == curve.memoryNode && !curve.levels.empty() &&
+            curve.levels.back().level == kExs_LatencyMemoryLevel) {
+            return curve.levels.back().nanoseconds;
+        }
+    }
+    return 0.0;
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,363 @@
+// src/Core/Platform/Common/ThreadPool.cpp
+#include "../internal/ThreadPool.h"
+#include "../internal/ThreadRegistry.h"
+#include <algorithm>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, PPoPP'13).
+// The owner pushes and pops at the bottom; thieves take from the top.
+class Exs_WorkStealingDeque {
+private:
+    struct Buffer {
+        int64 capacity;
+        std::unique_ptr<std::atomic<Exs_ThreadPoolTask*>[]> slots;
+
+        explicit Buffer(int64 size)
+            : capacity(size), slots(new std::atomic<Exs_ThreadPoolTask*>[size]) {}
+
+        Exs_ThreadPoolTask* get(int64 index) const {
+            return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64 index, Exs_ThreadPoolTask* task) {
+            slots[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<int64> top{0};
+    alignas(64) std::atomic<int64> bottom{0};
+    std::atomic<Buffer*> buffer;
+
+    // Buffers replaced by growth stay alive until the deque is destroyed,
+    // since a concurrent thief may still be reading from them
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+public:
+    Exs_WorkStealingDeque() {
+        buffers.emplace_back(new Buffer(256));
+        buffer.store(buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    // Owner only
+    void push(Exs_ThreadPoolTask* task) {
+        int64 b = bottom.load(std::memory_order_relaxed);
+        int64 t = top.load(std::memory_order_acquire);
+        Buffer* current = buffer.load(std::memory_order_relaxed);
+
+        if (b - t > current->capacity - 1) {
+            Buffer* grown = new Buffer(current->capacity * 2);
+            for (int64 i = t; i < b; i++) {
+                grown->put(i, current->get(i));
+            }
+            buffers.emplace_back(grown);
+            buffer.store(grown, std::memory_order_release);
+            current = grown;
+        }
+
+        current->put(b, task);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only
+    Exs_ThreadPoolTask* pop() {
+        int64 b = bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* current = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 t = top.load(std::memory_order_relaxed);
+
+        Exs_ThreadPoolTask* task = nullptr;
+        if (t <= b) {
+            task = current->get(b);
+            if (t == b) {
+                // Last element: race against thieves for it
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                 std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        } else {
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // Any thread
+    Exs_ThreadPoolTask* steal() {
+        int64 t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 b = bottom.load(std::memory_order_acquire);
+
+        if (t < b) {
+            Buffer* current = buffer.load(std::memory_order_acquire);
+            Exs_ThreadPoolTask* task = current->get(t);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return task;
+        }
+        return nullptr;
+    }
+};
+
+struct Exs_ThreadPool::Worker {
+    Exs_WorkStealingDeque deque;
+    Exs_WorkerPlacement placement;
+    std::vector<uint32> victims; // steal order, nearest first
+    std::thread thread;
+};
+
+static thread_local const Exs_ThreadPool* t_currentPool = nullptr;
+static thread_local int32 t_currentWorkerIndex = -1;
+
+// Distance class between two workers; lower is closer
+static uint32 Exs_PlacementDistance(const Exs_WorkerPlacement& a, const Exs_WorkerPlacement& b) {
+    if (a.coreKey == b.coreKey) return 0;
+    if (a.cacheKey == b.cacheKey) return 1;
+    if (a.numaNodeId == b.numaNodeId) return 2;
+    if (a.socketId == b.socketId) return 3;
+    return 4;
+}
+
+Exs_ThreadPool::Exs_ThreadPool(const Exs_ThreadPoolOptions& options) {
+    std::vector<Exs_WorkerPlacement> placements = Exs_DetectWorkerPlacements(options.pinning);
+    if (placements.empty()) {
+        placements.push_back({ 0, 0, 0, 0, 0, false });
+    }
+
+    uint32 workerCount = options.workerCount > 0
+        ? options.workerCount
+        : static_cast<uint32>(placements.size());
+
+    for (uint32 i = 0; i < workerCount; i++) {
+        std::unique_ptr<Worker> worker(new Worker());
+        worker->placement = placements[i % placements.size()];
+        workers.push_back(std::move(worker));
+    }
+
+    // Victim lists: nearest tier first, rotated by worker index within a tier
+    // so that thieves of one tier do not all hit the same victim
+    for (uint32 i = 0; i < workerCount; i++) {
+        std::vector<uint32>& victims = workers[i]->victims;
+        for (uint32 j = 0; j < workerCount; j++) {
+            if (j != i) {
+                victims.push_back(j);
+            }
+        }
+
+        const Exs_WorkerPlacement& self = workers[i]->placement;
+        std::stable_sort(victims.begin(), victims.end(), [&](uint32 a, uint32 b) {
+            uint32 distanceA = Exs_PlacementDistance(self, workers[a]->placement);
+            uint32 distanceB = Exs_PlacementDistance(self, workers[b]->placement);
+            if (distanceA != distanceB) {
+                return distanceA < distanceB;
+            }
+            return (a + workerCount - i) % workerCount < (b + workerCount - i) % workerCount;
+        });
+    }
+
+    bool pin = options.pinning != Exs_ThreadPinningPolicy::None;
+    for (uint32 i = 0; i < workerCount; i++) {
+        std::string workerName = options.name + "-" + std::to_string(i);
+        workers[i]->thread = std::thread([this, i, pin, workerName]() {
+            if (pin) {
+                Exs_PinCurrentThreadToCPU(workers[i]->placement.cpu);
+            }
+            Exs_RegisterCurrentThread(workerName.c_str(), "thread-pool");
+            workerMain(i);
+        });
+    }
+}
+
+Exs_ThreadPool::~Exs_ThreadPool() {
+    waitIdle();
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping.store(true);
+    }
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void Exs_ThreadPool::submit(Exs_ThreadPoolTask task) {
+    Exs_ThreadPoolTask* heapTask = new Exs_ThreadPoolTask(std::move(task));
+    outstandingTasks.fetch_add(1);
+
+    int32 workerIndex = getCurrentWorkerIndex();
+    if (workerIndex >= 0) {
+        workers[workerIndex]->deque.push(heapTask);
+    } else {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        injectionQueue.push_back(heapTask);
+    }
+
+    queuedTasks.fetch_add(1);
+    if (sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        sleepCondition.notify_one();
+    }
+}
+
+void Exs_ThreadPool::parallelFor(uint64 begin, uint64 end, uint64 grain,
+                                 const std::function<void(uint64 begin, uint64 end)>& body) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    // Shared with the chunks: the last one may still be notifying when the
+    // caller wakes up and returns, so this must not live on our stack
+    struct CompletionState {
+        std::atomic<uint64> remaining;
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+    };
+    std::shared_ptr<CompletionState> state = std::make_shared<CompletionState>();
+    state->remaining.store((end - begin + grain - 1) / grain);
+
+    for (uint64 chunk = begin; chunk < end; chunk += grain) {
+        uint64 chunkEnd = std::min(end, chunk + grain);
+        submit([state, &body, chunk, chunkEnd]() {
+            body(chunk, chunkEnd);
+            if (state->remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(state->doneMutex);
+                state->doneCondition.notify_all();
+            }
+        });
+    }
+
+    int32 workerIndex = getCurrentWorkerIndex();
+    if (workerIndex >= 0) {
+        // Never block a worker: help until our chunks are done
+        while (state->remaining.load() > 0) {
+            if (!runOneTask(workerIndex)) {
+                std::this_thread::yield();
+            }
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(state->doneMutex);
+    state->doneCondition.wait(lock, [&]() { return state->remaining.load() == 0; });
+}
+
+void Exs_ThreadPool::waitIdle() {
+    int32 workerIndex = getCurrentWorkerIndex();
+    if (workerIndex >= 0) {
+        // Tasks waiting in here stay outstanding until they return, so only
+        // the others count; otherwise two waiting tasks wait on each other
+        idleWaitingTasks.fetch_add(1);
+        while (outstandingTasks.load() > idleWaitingTasks.load()) {
+            if (!runOneTask(workerIndex)) {
+                std::this_thread::yield();
+            }
+        }
+        idleWaitingTasks.fetch_sub(1);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(idleMutex);
+    idleCondition.wait(lock, [this]() { return outstandingTasks.load() == 0; });
+}
+
+uint32 Exs_ThreadPool::getWorkerCount() const {
+    return static_cast<uint32>(workers.size());
+}
+
+const Exs_WorkerPlacement& Exs_ThreadPool::getWorkerPlacement(uint32 worker) const {
+    return workers[worker]->placement;
+}
+
+int32 Exs_ThreadPool::getCurrentWorkerIndex() const {
+    return t_currentPool == this ? t_currentWorkerIndex : -1;
+}
+
+void Exs_ThreadPool::workerMain(uint32 index) {
+    t_currentPool = this;
+    t_currentWorkerIndex = static_cast<int32>(index);
+
+    while (!stopping.load()) {
+        if (runOneTask(static_cast<int32>(index))) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1);
+        sleepCondition.wait(lock, [this]() {
+            return queuedTasks.load() > 0 || stopping.load();
+        });
+        sleepingWorkers.fetch_sub(1);
+    }
+
+    t_currentPool = nullptr;
+    t_currentWorkerIndex = -1;
+}
+
+bool Exs_ThreadPool::runOneTask(int32 workerIndex) {
+    Exs_ThreadPoolTask* task = nullptr;
+
+    if (workerIndex >= 0) {
+        task = workers[workerIndex]->deque.pop();
+    }
+
+    if (task == nullptr) {
+        std::lock_guard<std::mutex> lock(injectionMutex);
+        if (!injectionQueue.empty()) {
+            task = injectionQueue.front();
+            injectionQueue.pop_front();
+        }
+    }
+
+    if (task == nullptr) {
+        if (workerIndex >= 0) {
+            for (uint32 victim : workers[workerIndex]->victims) {
+                task = workers[victim]->deque.steal();
+                if (task != nullptr) {
+                    break;
+                }
+            }
+        } else {
+            for (auto& worker : workers) {
+                task = worker->deque.steal();
+                if (task != nullptr) {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (task == nullptr) {
+        return false;
+    }
+
+    queuedTasks.fetch_sub(1);
+    (*task)();
+    delete task;
+    finishTask();
+    return true;
+}
+
+void Exs_ThreadPool::finishTask() {
+    if (outstandingTasks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        idleCondition.notify_all();
+    }
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,103 @@
+// src/Core/Platform/Common/TopologyTree.cpp
+#include "../internal/TopologyTree.h"
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+const char* Exs_GetTopologyNodeTypeName(Exs_TopologyNodeType type) {
+    switch (type) {
+        case Exs_TopologyNodeType::Machine: return "machine";
+        case Exs_TopologyNodeType::Package: return "package";
+        case Exs_TopologyNodeType::NumaNode: return "numa_node";
+        case Exs_TopologyNodeType::L3Cache: return "l3";
+        case Exs_TopologyNodeType::L2Cache: return "l2";
+        case Exs_TopologyNodeType::Core: return "core";
+        case Exs_TopologyNodeType::PU: return "pu";
+    }
+    return "unknown";
+}
+
+std::vector<const Exs_TopologyNode*> Exs_GetTopologyNodes(const Exs_TopologyNode& root, Exs_TopologyNodeType type) {
+    std::vector<const Exs_TopologyNode*> nodes;
+    Exs_WalkTopology(root, [&](const Exs_TopologyNode& node, uint32) {
+        if (node.type == type) {
+            nodes.push_back(&node);
+        }
+    });
+    return nodes;
+}
+
+static void Exs_AppendCPUList(std::string& out, const std::vector<uint32>& cpus) {
+    for (size_t i = 0; i < cpus.size();) {
+        size_t last = i;
+        while (last + 1 < cpus.size() && cpus[last + 1] == cpus[last] + 1) {
+            last++;
+        }
+        if (i != 0) {
+            out += ',';
+        }
+        out += std::to_string(cpus[i]);
+        if (last != i) {
+            out += '-';
+            out += std::to_string(cpus[last]);
+        }
+        i = last + 1;
+    }
+}
+
+std::string Exs_FormatCPUList(const std::vector<uint32>& cpus) {
+    std::string out;
+    Exs_AppendCPUList(out, cpus);
+    return out;
+}
+
+static void Exs_AppendTopologyJSON(std::string& out, const Exs_TopologyNode& node) {
+    out += "{\"type\":\"";
+    out += Exs_GetTopologyNodeTypeName(node.type);
+    out += "\",\"id\":";
+    out += std::to_string(node.id);
+
+    // A PU is its own id; everything else lists the CPUs below it
+    if (node.type != Exs_TopologyNodeType::PU) {
+        out += ",\"cpus\":\"";
+        Exs_AppendCPUList(out, node.cpus);
+        out += '"';
+    }
+
+    if (node.type == Exs_TopologyNodeType::L3Cache || node.type == Exs_TopologyNodeType::L2Cache) {
+        out += ",\"size_kb\":";
+        out += std::to_string(node.sizeKB);
+    }
+
+    if (node.type == Exs_TopologyNodeType::Core) {
+        switch (node.coreType) {
+            case Exs_CPUCoreType::Performance: out += ",\"core_type\":\"performance\""; break;
+            case Exs_CPUCoreType::Efficiency: out += ",\"core_type\":\"efficiency\""; break;
+            case Exs_CPUCoreType::Unknown: break;
+        }
+    }
+
+    if (!node.children.empty()) {
+        out += ",\"children\":[";
+        for (size_t i = 0; i < node.children.size(); i++) {
+            if (i != 0) {
+                out += ',';
+            }
+            Exs_AppendTopologyJSON(out, node.children[i]);
+        }
+        out += ']';
+    }
+
+    out += '}';
+}
+
+std::string Exs_TopologyToJSON(const Exs_TopologyNode& node) {
+    std::string out;
+    Exs_AppendTopologyJSON(out, node);
+    return out;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
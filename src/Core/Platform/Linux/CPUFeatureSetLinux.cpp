@@ -0,0 +1,72 @@
+// src/Core/Platform/Linux/CPUFeatureSetLinux.cpp
+#include "../internal/CPUFeatureSet.h"
+#include <sys/auxv.h>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+#if defined(__aarch64__)
+static void Exs_DetectARMFeatures(Exs_CPUFeatureSet& set) {
+    struct Exs_HWCAPBit {
+        uint32 bit;
+        Exs_CPUFeature feature;
+    };
+
+    // Bit numbers from arch/arm64/include/uapi/asm/hwcap.h
+    static const Exs_HWCAPBit hwcap[] = {
+        { 0, Exs_CPUFeature::FP }, { 1, Exs_CPUFeature::ASIMD }, { 3, Exs_CPUFeature::AES },
+        { 4, Exs_CPUFeature::PMULL }, { 5, Exs_CPUFeature::SHA1 }, { 6, Exs_CPUFeature::SHA2 },
+        { 7, Exs_CPUFeature::CRC32 }, { 8, Exs_CPUFeature::ATOMICS }, { 9, Exs_CPUFeature::FPHP },
+        { 10, Exs_CPUFeature::ASIMDHP }, { 17, Exs_CPUFeature::SHA3 }, { 18, Exs_CPUFeature::SM3 },
+        { 19, Exs_CPUFeature::SM4 }, { 20, Exs_CPUFeature::ASIMDDP }, { 21, Exs_CPUFeature::SHA512 },
+        { 22, Exs_CPUFeature::SVE }, { 23, Exs_CPUFeature::ASIMDFHM }
+    };
+    static const Exs_HWCAPBit hwcap2[] = {
+        { 1, Exs_CPUFeature::SVE2 }, { 13, Exs_CPUFeature::I8MM }, { 14, Exs_CPUFeature::BF16 },
+        { 18, Exs_CPUFeature::MTE }
+    };
+
+    unsigned long bits = getauxval(AT_HWCAP);
+    for (const Exs_HWCAPBit& entry : hwcap) {
+        set.set(entry.feature, (bits & (1UL << entry.bit)) != 0);
+    }
+    unsigned long bits2 = getauxval(AT_HWCAP2);
+    for (const Exs_HWCAPBit& entry : hwcap2) {
+        set.set(entry.feature, (bits2 & (1UL << entry.bit)) != 0);
+    }
+}
+#elif defined(__arm__)
+static void Exs_DetectARMFeatures(Exs_CPUFeatureSet& set) {
+    // 32-bit ARM: HWCAP_NEON, HWCAP2_AES/PMULL/SHA1/SHA2/CRC32
+    unsigned long bits = getauxval(AT_HWCAP);
+    set.set(Exs_CPUFeature::ASIMD, (bits & (1UL << 12)) != 0);
+    set.set(Exs_CPUFeature::FP, (bits & (1UL << 6)) != 0);
+
+    unsigned long bits2 = getauxval(AT_HWCAP2);
+    set.set(Exs_CPUFeature::AES, (bits2 & (1UL << 0)) != 0);
+    set.set(Exs_CPUFeature::PMULL, (bits2 & (1UL << 1)) != 0);
+    set.set(Exs_CPUFeature::SHA1, (bits2 & (1UL << 2)) != 0);
+    set.set(Exs_CPUFeature::SHA2, (bits2 & (1UL << 3)) != 0);
+    set.set(Exs_CPUFeature::CRC32, (bits2 & (1UL << 4)) != 0);
+}
+#endif
+
+static Exs_CPUFeatureSet Exs_DetectCPUFeatureSet() {
+    Exs_CPUFeatureSet set;
+#if defined(__x86_64__) || defined(__i386__)
+    Exs_DetectX86CPUFeatures(set);
+#elif defined(__aarch64__) || defined(__arm__)
+    Exs_DetectARMFeatures(set);
+#endif
+    return set;
+}
+
+const Exs_CPUFeatureSet& Exs_GetCPUFeatureSet() {
+    static const Exs_CPUFeatureSet features = Exs_DetectCPUFeatureSet();
+    return features;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,691 @@
+// src/Core/Platform/Linux/CPUInfoLinux.cpp
+#include "../internal/CPUInfoBase.h"
+#include "../internal/PerfCounters.h"
+#include "../internal/CPUUsageSampler.h"
+#include "../internal/PowerCap.h"
+#include "../internal/ThermalSensors.h"
+#include "../internal/CPUFeatureSet.h"
+#include "../internal/CPUID.h"
+#include "../internal/CoreFrequency.h"
+#include "../internal/CoreTypes.h"
+#include "../internal/TopologyTree.h"
+#include "../internal/NumaMemory.h"
+#include "SysfsLinux.h"
+#include <unistd.h>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <mutex>
+#include <memory>
+#include <cmath>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ReadSysfsFile;
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+using Platform::Exs_ParseCPUList;
+using Platform::Exs_GetOnlineCPUs;
+
+// Per logical CPU topology, read once from sysfs
+struct Exs_LogicalCPUInfo {
+    uint32 cpu;
+    uint32 coreId;
+    uint32 packageId;
+    uint32 numaNodeId;
+    uint32 maxFrequencyMHz;
+    bool isHyperThread;
+};
+
+// Everything that does not change while the process runs
+struct Exs_CPUStaticInfo {
+    std::string name;
+    std::string vendorString;
+    Exs_CPUVendor vendor = Exs_CPUVendor::Unknown;
+    uint32 family = 0;
+    uint32 model = 0;
+    uint32 stepping = 0;
+
+    uint32 physicalCoreCount = 0;
+    uint32 logicalCoreCount = 0;
+    uint32 socketCount = 0;
+    uint32 numaNodeCount = 0;
+
+    uint32 baseFrequencyMHz = 0;
+    uint32 maxTurboFrequencyMHz = 0;
+
+    std::vector<Exs_CPUCacheInfo> caches;
+    std::vector<Exs_LogicalCPUInfo> cpus;
+
+    Exs_CPUFeatures features = {};
+    bool is64Bit = false;
+};
+
+// Scans the first "key : value" block of /proc/cpuinfo in place. The buffer
+// is caller-owned and the callback receives pointers into it.
+template <typename Callback>
+static void Exs_ScanCPUInfoBlock(char* buffer, Callback callback) {
+    char* line = buffer;
+    while (line != nullptr && *line != '\0') {
+        char* next = strchr(line, '\n');
+        if (next != nullptr) {
+            *next = '\0';
+            next++;
+        }
+
+        // A blank line ends the first processor block
+        if (*line == '\0') {
+            break;
+        }
+
+        char* colon = strchr(line, ':');
+        if (colon != nullptr) {
+            char* keyEnd = colon;
+            while (keyEnd > line && (keyEnd[-1] == ' ' || keyEnd[-1] == '\t')) {
+                keyEnd--;
+            }
+            *keyEnd = '\0';
+
+            char* value = colon + 1;
+            while (*value == ' ' || *value == '\t') {
+                value++;
+            }
+            callback(line, value);
+        }
+
+        line = next;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static Exs_CPUVendor Exs_VendorFromString(const std::string& vendor) {
+    if (vendor == "GenuineIntel") return Exs_CPUVendor::Intel;
+    if (vendor == "AuthenticAMD" || vendor == "HygonGenuine") return Exs_CPUVendor::AMD;
+    if (vendor == "CentaurHauls" || vendor == "  Shanghai  ") return Exs_CPUVendor::VIA;
+    return Exs_CPUVendor::Unknown;
+}
+#else
+// ARM "CPU implementer" codes
+static Exs_CPUVendor Exs_VendorFromArmImplementer(unsigned long implementer, std::string& name) {
+    switch (implementer) {
+        case 0x41: name = "ARM"; return Exs_CPUVendor::ARM;
+        case 0x51: name = "Qualcomm"; return Exs_CPUVendor::Qualcomm;
+        case 0x53: name = "Samsung"; return Exs_CPUVendor::Samsung;
+        case 0x61: name = "Apple"; return Exs_CPUVendor::Apple;
+        default: name = "Unknown"; return Exs_CPUVendor::Unknown;
+    }
+}
+#endif
+
+static void Exs_DetectIdentification(Exs_CPUStaticInfo& info) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32 cpuInfo[4] = {0};
+
+    Exs_ReadCPUID(0, 0, cpuInfo);
+    char vendorString[13] = {0};
+    memcpy(vendorString, &cpuInfo[1], 4);
+    memcpy(vendorString + 4, &cpuInfo[3], 4);
+    memcpy(vendorString + 8, &cpuInfo[2], 4);
+    info.vendorString = vendorString;
+    info.vendor = Exs_VendorFromString(info.vendorString);
+
+    Exs_ReadCPUID(1, 0, cpuInfo);
+    info.family = ((cpuInfo[0] >> 8) & 0xF) + (((cpuInfo[0] >> 8) & 0xF) == 0xF ? ((cpuInfo[0] >> 20) & 0xFF) : 0);
+    info.model = ((cpuInfo[0] >> 4) & 0xF) | ((cpuInfo[0] >> 12) & 0xF0);
+    info.stepping = cpuInfo[0] & 0xF;
+
+    // Brand string
+    if (Exs_GetMaxCPUIDLeaf(0x80000000) >= 0x80000004) {
+        char brand[49] = {0};
+        for (int32 leaf = 0; leaf < 3; leaf++) {
+            Exs_ReadCPUID(0x80000002 + leaf, 0, cpuInfo);
+            memcpy(brand + leaf * 16, cpuInfo, sizeof(cpuInfo));
+        }
+        info.name = brand;
+        info.name.erase(0, info.name.find_first_not_of(' '));
+        info.name.erase(info.name.find_last_not_of(" \n\r\t") + 1);
+
+        Exs_ReadCPUID(0x80000001, 0, cpuInfo);
+        info.is64Bit = (cpuInfo[3] & (1 << 29)) != 0;
+    }
+#else
+    // One bounded read: only the first processor block is needed
+    char buffer[16384];
+    unsigned long implementer = 0, variant = 0, part = 0, revision = 0;
+    if (Exs_ReadSysfsFile("/proc/cpuinfo", buffer, sizeof(buffer)) > 0) {
+        Exs_ScanCPUInfoBlock(buffer, [&](const char* key, const char* value) {
+            if (strcmp(key, "CPU implementer") == 0) implementer = strtoul(value, nullptr, 0);
+            else if (strcmp(key, "CPU variant") == 0) variant = strtoul(value, nullptr, 0);
+            else if (strcmp(key, "CPU part") == 0) part = strtoul(value, nullptr, 0);
+            else if (strcmp(key, "CPU revision") == 0) revision = strtoul(value, nullptr, 0);
+            else if (strcmp(key, "model name") == 0 && info.name.empty()) info.name = value;
+        });
+    }
+
+    info.vendor = Exs_VendorFromArmImplementer(implementer, info.vendorString);
+    info.family = static_cast<uint32>(variant);
+    info.model = static_cast<uint32>(part);
+    info.stepping = static_cast<uint32>(revision);
+    if (info.name.empty()) {
+        std::stringstream ss;
+        ss << info.vendorString << " 0x" << std::hex << part;
+        info.name = ss.str();
+    }
+#if defined(__aarch64__)
+    info.is64Bit = true;
+#endif
+#endif
+}
+
+static void Exs_DetectFeatures(Exs_CPUStaticInfo& info) {
+    const Exs_CPUFeatureSet& set = Exs_GetCPUFeatureSet();
+    Exs_CPUFeatures& features = info.features;
+
+    // Summary flags derived from the full bitmap
+    features.mmx = set.has(Exs_CPUFeature::MMX);
+    features.sse = set.has(Exs_CPUFeature::SSE);
+    features.sse2 = set.has(Exs_CPUFeature::SSE2);
+    features.sse3 = set.has(Exs_CPUFeature::SSE3);
+    features.ssse3 = set.has(Exs_CPUFeature::SSSE3);
+    features.sse4_1 = set.has(Exs_CPUFeature::SSE4_1);
+    features.sse4_2 = set.has(Exs_CPUFeature::SSE4_2);
+    features.avx = set.has(Exs_CPUFeature::AVX);
+    features.avx2 = set.has(Exs_CPUFeature::AVX2);
+    features.avx512 = set.has(Exs_CPUFeature::AVX512F);
+    features.fma = set.has(Exs_CPUFeature::FMA);
+    features.aes = set.has(Exs_CPUFeature::AES);
+    features.neon = set.has(Exs_CPUFeature::ASIMD);
+    features.asimd = set.has(Exs_CPUFeature::ASIMD);
+    features.fp16 = set.has(Exs_CPUFeature::FPHP);
+    features.crypto = set.has(Exs_CPUFeature::AES) && set.has(Exs_CPUFeature::SHA1);
+    features.vmx = set.has(Exs_CPUFeature::VMX);
+    features.svm = set.has(Exs_CPUFeature::SVM);
+    features.hypervisor = set.has(Exs_CPUFeature::HYPERVISOR);
+    features.sgx = set.has(Exs_CPUFeature::SGX);
+    features.mte = set.has(Exs_CPUFeature::MTE);
+
+#if defined(__x86_64__) || defined(__i386__)
+    // Power management bits are not part of the feature bitmap
+    uint32 cpuInfo[4] = {0};
+    uint32 maxLeaf = Exs_GetMaxCPUIDLeaf(0);
+
+    Exs_ReadCPUID(1, 0, cpuInfo);
+    features.speedStep = (cpuInfo[2] & (1 << 7)) != 0;
+
+    if (maxLeaf >= 6) {
+        Exs_ReadCPUID(6, 0, cpuInfo);
+        features.turboBoost = (cpuInfo[0] & (1 << 1)) != 0;
+    }
+
+    if (Exs_GetMaxCPUIDLeaf(0x80000000) >= 0x80000007) {
+        Exs_ReadCPUID(0x80000007, 0, cpuInfo);
+        features.powerNow = info.vendor == Exs_CPUVendor::AMD && (cpuInfo[3] & (1 << 7)) != 0;
+    }
+#endif
+
+    // TPM presence is a platform property rather than a CPU one
+    features.tpm = access("/sys/class/tpm/tpm0", F_OK) == 0;
+}
+
+static void Exs_DetectTopology(Exs_CPUStaticInfo& info) {
+    std::vector<uint32> nodes = Exs_ParseCPUList(
+        Exs_ReadSysfsString("/sys/devices/system/node/online").c_str());
+    info.numaNodeCount = nodes.empty() ? 1 : static_cast<uint32>(nodes.size());
+
+    std::vector<std::pair<uint32, uint32>> cores;
+    std::vector<uint32> packages;
+
+    for (uint32 cpu : Exs_GetOnlineCPUs()) {
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/";
+
+        Exs_LogicalCPUInfo logical = {};
+        logical.cpu = cpu;
+
+        uint64 value = 0;
+        logical.coreId = Exs_ReadSysfsUInt64(base + "topology/core_id", value) ? static_cast<uint32>(value) : cpu;
+        logical.packageId = Exs_ReadSysfsUInt64(base + "topology/physical_package_id", value) ? static_cast<uint32>(value) : 0;
+        logical.numaNodeId = MemoryInfo::Exs_GetNumaNodeOfCPU(cpu);
+        logical.maxFrequencyMHz = Exs_ReadSysfsUInt64(base + "cpufreq/cpuinfo_max_freq", value)
+            ? static_cast<uint32>(value / 1000)
+            : 0;
+
+        // The first CPU in the sibling list is the primary thread of the core
+        std::vector<uint32> siblings = Exs_ParseCPUList(
+            Exs_ReadSysfsString(base + "topology/thread_siblings_list").c_str());
+        logical.isHyperThread = !siblings.empty() && siblings.front() != cpu;
+
+        std::pair<uint32, uint32> core(logical.packageId, logical.coreId);
+        if (std::find(cores.begin(), cores.end(), core) == cores.end()) {
+            cores.push_back(core);
+        }
+        if (std::find(packages.begin(), packages.end(), logical.packageId) == packages.end()) {
+            packages.push_back(logical.packageId);
+        }
+
+        info.cpus.push_back(logical);
+    }
+
+    info.logicalCoreCount = static_cast<uint32>(info.cpus.size());
+    info.physicalCoreCount = cores.empty() ? info.logicalCoreCount : static_cast<uint32>(cores.size());
+    info.socketCount = packages.empty() ? 1 : static_cast<uint32>(packages.size());
+}
+
+static void Exs_DetectCaches(Exs_CPUStaticInfo& info) {
+    // Cache hierarchy as seen from the first online CPU
+    uint32 cpu = info.cpus.empty() ? 0 : info.cpus.front().cpu;
+    std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+
+    for (uint32 index = 0; index < 16; index++) {
+        std::string dir = base + std::to_string(index) + "/";
+        uint64 level = 0;
+        if (!Exs_ReadSysfsUInt64(dir + "level", level)) {
+            break;
+        }
+
+        Exs_CPUCacheInfo cache = {};
+        cache.level = static_cast<uint32>(level);
+
+        // Size is reported as e.g. "48K" or "32M"
+        std::string size = Exs_ReadSysfsString(dir + "size");
+        uint64 sizeValue = strtoull(size.c_str(), nullptr, 10);
+        if (!size.empty() && size.back() == 'M') {
+            sizeValue *= 1024;
+        }
+        cache.sizeKB = static_cast<uint32>(sizeValue);
+
+        uint64 value = 0;
+        cache.lineSize = Exs_ReadSysfsUInt64(dir + "coherency_line_size", value) ? static_cast<uint32>(value) : 0;
+        cache.associativity = Exs_ReadSysfsUInt64(dir + "ways_of_associativity", value) ? static_cast<uint32>(value) : 0;
+        cache.type = Exs_ReadSysfsString(dir + "type");
+
+        info.caches.push_back(cache);
+    }
+}
+
+static void Exs_DetectFrequencies(Exs_CPUStaticInfo& info) {
+#if defined(__x86_64__) || defined(__i386__)
+    // Leaf 0x16 reports base and maximum frequency in MHz on Intel parts
+    uint32 cpuInfo[4] = {0};
+    if (Exs_GetMaxCPUIDLeaf(0) >= 0x16) {
+        Exs_ReadCPUID(0x16, 0, cpuInfo);
+        info.baseFrequencyMHz = static_cast<uint32>(cpuInfo[0] & 0xFFFF);
+        info.maxTurboFrequencyMHz = static_cast<uint32>(cpuInfo[1] & 0xFFFF);
+    }
+#endif
+
+    uint64 value = 0;
+    if (info.baseFrequencyMHz == 0 &&
+        Exs_ReadSysfsUInt64("/sys/devices/system/cpu/cpu0/cpufreq/base_frequency", value)) {
+        info.baseFrequencyMHz = static_cast<uint32>(value / 1000);
+    }
+
+    uint32 maxFrequency = 0;
+    for (const auto& cpu : info.cpus) {
+        maxFrequency = std::max(maxFrequency, cpu.maxFrequencyMHz);
+    }
+    if (maxFrequency > info.maxTurboFrequencyMHz) {
+        info.maxTurboFrequencyMHz = maxFrequency;
+    }
+
+    if (info.baseFrequencyMHz == 0) {
+        // Last resort: "cpu MHz" of the first processor block
+        char buffer[16384];
+        if (Exs_ReadSysfsFile("/proc/cpuinfo", buffer, sizeof(buffer)) > 0) {
+            Exs_ScanCPUInfoBlock(buffer, [&](const char* key, const char* value) {
+                if (strcmp(key, "cpu MHz") == 0) {
+                    info.baseFrequencyMHz = static_cast<uint32>(strtod(value, nullptr));
+                }
+            });
+        }
+    }
+
+    if (info.maxTurboFrequencyMHz == 0) {
+        info.maxTurboFrequencyMHz = info.baseFrequencyMHz;
+    }
+}
+
+static Exs_CPUStaticInfo Exs_BuildCPUStaticInfo() {
+    Exs_CPUStaticInfo info;
+    Exs_DetectIdentification(info);
+    Exs_DetectFeatures(info);
+    Exs_DetectTopology(info);
+    Exs_DetectCaches(info);
+    Exs_DetectFrequencies(info);
+    return info;
+}
+
+// Parsed once per process; every getter below reads from this snapshot
+static const Exs_CPUStaticInfo& Exs_GetCPUStaticInfo() {
+    static const Exs_CPUStaticInfo info = Exs_BuildCPUStaticInfo();
+    return info;
+}
+
+// Online logical CPU ids in topology order
+static std::vector<uint32> Exs_GetStaticCPUIds() {
+    const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+    std::vector<uint32> cpus;
+    cpus.reserve(info.cpus.size());
+    for (const auto& cpu : info.cpus) {
+        cpus.push_back(cpu.cpu);
+    }
+    return cpus;
+}
+
+// Dynamic getters called more often than this reuse the previous sample;
+// shorter intervals are mostly rounding noise in the kernel's counters
+constexpr uint32 kExs_MinSampleIntervalMs = 100;
+
+class Exs_CPUInfoLinux : public Exs_CPUInfoBase {
+private:
+    // All-CPU /proc/stat sampler; usage queries share its latest interval
+    mutable Exs_CPUUsageSampler usageSampler;
+
+    // RAPL energy counters of all packages and subdomains, sampled at most
+    // every kExs_MinSampleIntervalMs
+    mutable Exs_PowerMonitor powerMonitor;
+
+    // Temperature inputs, discovered once
+    Exs_ThermalSensors thermalSensors;
+
+    // APERF/MPERF effective frequency of every CPU, same order as the static CPU list
+    mutable Exs_CoreFrequencySampler frequencySampler;
+
+    // Process-wide hardware counters, opened on first use
+    mutable std::once_flag countersOnce;
+    mutable std::unique_ptr<Exs_PerfCounterGroup> counters;
+
+public:
+    Exs_CPUInfoLinux()
+        : frequencySampler(Exs_GetStaticCPUIds(), Exs_GetCPUStaticInfo().baseFrequencyMHz) {
+        // Baselines, so that the first queries already have an interval
+        usageSampler.sample();
+        powerMonitor.sample();
+    }
+
+    virtual ~Exs_CPUInfoLinux() = default;
+
+    std::string getCPUName() const override {
+        return Exs_GetCPUStaticInfo().name;
+    }
+
+    Exs_CPUVendor getCPUVendor() const override {
+        return Exs_GetCPUStaticInfo().vendor;
+    }
+
+    std::string getCPUVendorString() const override {
+        return Exs_GetCPUStaticInfo().vendorString;
+    }
+
+    std::string getCPUFamily() const override {
+        const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+        std::stringstream ss;
+        ss << "Family " << info.family << " Model " << std::hex << info.model;
+        return ss.str();
+    }
+
+    std::string getCPUModel() const override {
+        const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+        std::stringstream ss;
+        ss << "Model " << std::hex << info.model << std::dec << " Stepping " << info.stepping;
+        return ss.str();
+    }
+
+    std::string getCPUStepping() const override {
+        return std::to_string(Exs_GetCPUStaticInfo().stepping);
+    }
+
+    uint32 getPhysicalCoreCount() const override {
+        return Exs_GetCPUStaticInfo().physicalCoreCount;
+    }
+
+    uint32 getLogicalCoreCount() const override {
+        return Exs_GetCPUStaticInfo().logicalCoreCount;
+    }
+
+    uint32 getSocketCount() const override {
+        return Exs_GetCPUStaticInfo().socketCount;
+    }
+
+    uint32 getNumaNodeCount() const override {
+        return Exs_GetCPUStaticInfo().numaNodeCount;
+    }
+
+    uint32 getBaseFrequencyMHz() const override {
+        return Exs_GetCPUStaticInfo().baseFrequencyMHz;
+    }
+
+    uint32 getMaxTurboFrequencyMHz() const override {
+        return Exs_GetCPUStaticInfo().maxTurboFrequencyMHz;
+    }
+
+    uint32 getCurrentFrequencyMHz() const override {
+        // Mean effective frequency over all CPUs
+        std::vector<Exs_CoreFrequencySample> samples;
+        frequencySampler.sample(samples, kExs_MinSampleIntervalMs);
+
+        uint64 total = 0, count = 0;
+        for (const auto& sample : samples) {
+            if (sample.valid) {
+                total += sample.effectiveMHz;
+                count++;
+            }
+        }
+        return count > 0 ? static_cast<uint32>(total / count) : Exs_GetCPUStaticInfo().baseFrequencyMHz;
+    }
+
+    std::vector<Exs_CPUCacheInfo> getCacheInfo() const override {
+        return Exs_GetCPUStaticInfo().caches;
+    }
+
+    uint32 getCacheSize(uint32 level, const std::string& type) const override {
+        for (const auto& cache : Exs_GetCPUStaticInfo().caches) {
+            if (cache.level == level && cache.type == type) {
+                return cache.sizeKB;
+            }
+        }
+        return 0;
+    }
+
+    std::vector<Exs_CPUCoreInfo> getCoreInfo() const override {
+        const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+        std::vector<Exs_CPUCoreInfo> coreInfo;
+        coreInfo.reserve(info.cpus.size());
+
+        // One sample of each dynamic source for all cores
+        Exs_CPUUsageSnapshot usage;
+        bool haveUsage = takeUsageSnapshot(usage);
+        std::vector<int32> temperatures = getCoreTemperatures();
+        std::vector<Exs_CoreFrequencySample> frequencies;
+        frequencySampler.sample(frequencies, kExs_MinSampleIntervalMs);
+
+        for (size_t i = 0; i < info.cpus.size(); i++) {
+            const Exs_LogicalCPUInfo& cpu = info.cpus[i];
+
+            Exs_CPUCoreInfo core = {};
+            core.coreId = cpu.cpu;
+            core.physicalId = cpu.coreId;
+            core.socketId = cpu.packageId;
+            core.numaNodeId = cpu.numaNodeId;
+            core.maxFrequencyMHz = cpu.maxFrequencyMHz != 0 ? cpu.maxFrequencyMHz : info.maxTurboFrequencyMHz;
+            core.currentFrequencyMHz = i < frequencies.size() && frequencies[i].valid
+                ? frequencies[i].effectiveMHz
+                : info.baseFrequencyMHz;
+            core.temperatureCelsius = i < temperatures.size() ? static_cast<uint32>(std::max(temperatures[i], 0)) : 0;
+            core.utilizationPercentage = haveUsage && cpu.cpu < usage.cpus.size() ? usage.cpus[cpu.cpu].busy : 0.0;
+            core.isHyperThread = cpu.isHyperThread;
+
+            const Exs_CoreTypeInfo* type = Exs_GetCoreTypeOfCPU(cpu.cpu);
+            core.coreType = type != nullptr ? type->type : Exs_CPUCoreType::Unknown;
+            core.relativeCapacity = type != nullptr ? type->capacity : 0;
+            coreInfo.push_back(core);
+        }
+
+        return coreInfo;
+    }
+
+    Exs_CPUCoreInfo getCoreInfoById(uint32 coreId) const override {
+        auto cores = getCoreInfo();
+        for (const auto& core : cores) {
+            if (core.coreId == coreId) {
+                return core;
+            }
+        }
+        return Exs_CPUCoreInfo();
+    }
+
+    Exs_CPUFeatures getCPUFeatures() const override {
+        return Exs_GetCPUStaticInfo().features;
+    }
+
+    bool supportsFeature(const std::string& feature) const override {
+        Exs_CPUFeature id;
+        return Exs_FindCPUFeature(feature, id) && Exs_GetCPUFeatureSet().has(id);
+    }
+
+    double getTotalCPUUsage() const override {
+        Exs_CPUUsageSnapshot usage;
+        return takeUsageSnapshot(usage) ? usage.total.busy : 0.0;
+    }
+
+    double getCoreUsage(uint32 coreId) const override {
+        Exs_CPUUsageSnapshot usage;
+        if (!takeUsageSnapshot(usage) || coreId >= usage.cpus.size()) {
+            return 0.0;
+        }
+        return usage.cpus[coreId].busy;
+    }
+
+    std::vector<double> getAllCoreUsage() const override {
+        const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+        std::vector<double> usages(info.cpus.size(), 0.0);
+
+        Exs_CPUUsageSnapshot usage;
+        if (takeUsageSnapshot(usage)) {
+            for (size_t i = 0; i < info.cpus.size(); i++) {
+                uint32 cpu = info.cpus[i].cpu;
+                usages[i] = cpu < usage.cpus.size() ? usage.cpus[cpu].busy : 0.0;
+            }
+        }
+        return usages;
+    }
+
+    int32 getCPUTemperature() const override {
+        return thermalSensors.readHottestPackage();
+    }
+
+    std::vector<int32> getCoreTemperatures() const override {
+        return thermalSensors.readCPUTemperatures(Exs_GetStaticCPUIds());
+    }
+
+    double getCPUPowerUsage() const override {
+        if (!powerMonitor.sample(kExs_MinSampleIntervalMs)) {
+            return 0.0;
+        }
+        return powerMonitor.getPackagePowerWatts();
+    }
+
+    double getCPUPowerLimit() const override {
+        return powerMonitor.getPackagePowerLimitWatts();
+    }
+
+    uint64 getInstructionsPerCycle() const override {
+        // Rounded to the nearest integer; Exs_GetInstructionsPerCycle() on a
+        // sample gives the exact ratio
+        Exs_PerfCounterSample sample;
+        if (!readCounters(sample)) {
+            return 0;
+        }
+        return static_cast<uint64>(std::llround(Exs_GetInstructionsPerCycle(sample)));
+    }
+
+    uint64 getTotalInstructions() const override {
+        return readCounter(Exs_PerfCounterEvent::Instructions);
+    }
+
+    uint64 getCacheMisses() const override {
+        return readCounter(Exs_PerfCounterEvent::CacheMisses);
+    }
+
+    uint64 getBranchMisses() const override {
+        return readCounter(Exs_PerfCounterEvent::BranchMisses);
+    }
+
+    uint64 getCycles() const override {
+        return readCounter(Exs_PerfCounterEvent::Cycles);
+    }
+
+    std::string getTopologyString() const override {
+        std::stringstream ss;
+
+        ss << "Physical Cores: " << getPhysicalCoreCount() << "\n";
+        ss << "Logical Cores: " << getLogicalCoreCount() << "\n";
+        ss << "Sockets: " << getSocketCount() << "\n";
+        ss << "NUMA Nodes: " << getNumaNodeCount() << "\n";
+
+        if (Exs_IsHybridCPU()) {
+            ss << "Performance CPUs: " << Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Performance).size() << "\n";
+            ss << "Efficiency CPUs: " << Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Efficiency).size() << "\n";
+        }
+
+        for (const auto& cache : Exs_GetCPUStaticInfo().caches) {
+            ss << "L" << cache.level << " " << cache.type
+               << " Cache: " << cache.sizeKB << " KB\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string getTopologyJSON() const override {
+        return Exs_GetTopologyJSON();
+    }
+
+    bool supportsVirtualization() const override {
+        const Exs_CPUFeatures& features = Exs_GetCPUStaticInfo().features;
+        return (features.vmx || features.svm) && !features.hypervisor;
+    }
+
+    bool supports64Bit() const override {
+        return Exs_GetCPUStaticInfo().is64Bit;
+    }
+
+    bool supportsHyperThreading() const override {
+        const Exs_CPUStaticInfo& info = Exs_GetCPUStaticInfo();
+        return info.logicalCoreCount > info.physicalCoreCount;
+    }
+
+private:
+    // Counts since the first counter query on this instance
+    bool readCounters(Exs_PerfCounterSample& sample) const {
+        std::call_once(countersOnce, [this]() {
+            counters.reset(new Exs_PerfCounterGroup(Exs_PerfCounterScope::Process));
+        });
+        return counters->read(sample);
+    }
+
+    uint64 readCounter(Exs_PerfCounterEvent event) const {
+        Exs_PerfCounterSample sample;
+        return readCounters(sample) ? sample.get(event) : 0;
+    }
+
+    // Latest published interval, refreshed once it is at least
+    // kExs_MinSampleIntervalMs old
+    bool takeUsageSnapshot(Exs_CPUUsageSnapshot& usage) const {
+        usageSampler.sample(kExs_MinSampleIntervalMs);
+        return usageSampler.getSnapshot(usage);
+    }
+};
+
+// Factory function implementation
+Exs_CPUInfoBase* Exs_CreateCPUInfoInstance() {
+    return new Exs_CPUInfoLinux();
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
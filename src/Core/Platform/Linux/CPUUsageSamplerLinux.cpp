@@ -0,0 +1,220 @@
+// src/Core/Platform/Linux/CPUUsageSamplerLinux.cpp
+#include "../internal/CPUUsageSampler.h"
+#include "SysfsLinux.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// /proc/stat columns used: user nice system idle iowait irq softirq steal
+constexpr uint32 kExs_CPUTimeFields = 8;
+
+// One published interval, guarded by its own sequence counter
+struct Exs_CPUUsageBuffer {
+    std::atomic<uint32> version{0};
+    uint64 sequence = 0;
+    uint64 intervalNs = 0;
+    Exs_CPUTimeBreakdown total = {};
+    std::vector<Exs_CPUTimeBreakdown> cpus; // sized once, never reallocated
+};
+
+static Exs_CPUTimeBreakdown Exs_ComputeBreakdown(const uint64* previous, const uint64* current) {
+    uint64 delta[kExs_CPUTimeFields];
+    uint64 total = 0;
+    for (uint32 i = 0; i < kExs_CPUTimeFields; i++) {
+        // Counters can step back slightly when a CPU comes online again
+        delta[i] = current[i] > previous[i] ? current[i] - previous[i] : 0;
+        total += delta[i];
+    }
+
+    Exs_CPUTimeBreakdown breakdown = {};
+    breakdown.online = true;
+    if (total == 0) {
+        breakdown.idle = 100.0;
+        return breakdown;
+    }
+
+    double scale = 100.0 / static_cast<double>(total);
+    breakdown.user = static_cast<double>(delta[0] + delta[1]) * scale;
+    breakdown.system = static_cast<double>(delta[2]) * scale;
+    breakdown.idle = static_cast<double>(delta[3]) * scale;
+    breakdown.iowait = static_cast<double>(delta[4]) * scale;
+    breakdown.irq = static_cast<double>(delta[5] + delta[6]) * scale;
+    breakdown.steal = static_cast<double>(delta[7]) * scale;
+    breakdown.busy = 100.0 - breakdown.idle - breakdown.iowait;
+    return breakdown;
+}
+
+Exs_CPUUsageSampler::Exs_CPUUsageSampler()
+    : fd(open("/proc/stat", O_RDONLY | O_CLOEXEC)),
+      cpuCapacity(0),
+      readBuffer(64 * 1024),
+      previousTimestampNs(0),
+      havePrevious(false) {
+    // Slots for every possible CPU so that hotplug never resizes anything
+    std::vector<uint32> possible = Platform::Exs_ParseCPUList(
+        Platform::Exs_ReadSysfsString("/sys/devices/system/cpu/possible").c_str());
+    cpuCapacity = possible.empty() ? static_cast<uint32>(sysconf(_SC_NPROCESSORS_CONF)) : possible.back() + 1;
+    if (cpuCapacity == 0) {
+        cpuCapacity = 1;
+    }
+
+    size_t slots = static_cast<size_t>(cpuCapacity) + 1;
+    previousTimes.assign(slots * kExs_CPUTimeFields, 0);
+    currentTimes.assign(slots * kExs_CPUTimeFields, 0);
+    previousSeen.assign(slots, false);
+    currentSeen.assign(slots, false);
+    scratch.assign(cpuCapacity, Exs_CPUTimeBreakdown());
+
+    for (auto& buffer : buffers) {
+        buffer.reset(new Exs_CPUUsageBuffer());
+        buffer->cpus.assign(cpuCapacity, Exs_CPUTimeBreakdown());
+    }
+}
+
+Exs_CPUUsageSampler::~Exs_CPUUsageSampler() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+uint32 Exs_CPUUsageSampler::getCPUCapacity() const {
+    return cpuCapacity;
+}
+
+bool Exs_CPUUsageSampler::sample(uint32 minIntervalMs) {
+    if (fd < 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(sampleMutex);
+
+    if (havePrevious && Platform::Exs_KeepLastSample(previousTimestampNs, minIntervalMs,
+                                                     sequence.load(std::memory_order_relaxed) > 0)) {
+        return true;
+    }
+
+    return readAndPublish();
+}
+
+bool Exs_CPUUsageSampler::readAndPublish() {
+    // One pread() from offset 0; grow only if the file did not fit
+    ssize_t bytes = 0;
+    while (true) {
+        bytes = pread(fd, readBuffer.data(), readBuffer.size() - 1, 0);
+        if (bytes < 0) {
+            return false;
+        }
+        if (static_cast<size_t>(bytes) < readBuffer.size() - 1) {
+            break;
+        }
+        readBuffer.resize(readBuffer.size() * 2);
+    }
+    readBuffer[static_cast<size_t>(bytes)] = '\0';
+    uint64 timestampNs = Platform::Exs_GetMonotonicNanoseconds();
+
+    std::fill(currentSeen.begin(), currentSeen.end(), false);
+
+    // The cpu lines come first; stop at the first other line
+    char* line = readBuffer.data();
+    while (line != nullptr && strncmp(line, "cpu", 3) == 0) {
+        char* cursor = line + 3;
+        size_t slot = 0;
+        if (*cursor >= '0' && *cursor <= '9') {
+            unsigned long cpu = strtoul(cursor, &cursor, 10);
+            slot = cpu < cpuCapacity ? static_cast<size_t>(cpu) + 1 : 0;
+            if (slot == 0) {
+                line = strchr(cursor, '\n');
+                line = line != nullptr ? line + 1 : nullptr;
+                continue;
+            }
+        }
+
+        uint64* fields = &currentTimes[slot * kExs_CPUTimeFields];
+        for (uint32 i = 0; i < kExs_CPUTimeFields; i++) {
+            fields[i] = strtoull(cursor, &cursor, 10);
+        }
+        currentSeen[slot] = true;
+
+        line = strchr(cursor, '\n');
+        line = line != nullptr ? line + 1 : nullptr;
+    }
+
+    bool didPublish = false;
+    if (havePrevious && currentSeen[0] && previousSeen[0]) {
+        for (uint32 cpu = 0; cpu < cpuCapacity; cpu++) {
+            size_t slot = static_cast<size_t>(cpu) + 1;
+            if (currentSeen[slot] && previousSeen[slot]) {
+                scratch[cpu] = Exs_ComputeBreakdown(&previousTimes[slot * kExs_CPUTimeFields],
+                                                    &currentTimes[slot * kExs_CPUTimeFields]);
+            } else {
+                scratch[cpu] = Exs_CPUTimeBreakdown();
+            }
+        }
+
+        Exs_CPUTimeBreakdown total = Exs_ComputeBreakdown(&previousTimes[0], &currentTimes[0]);
+        publish(total, scratch, timestampNs - previousTimestampNs);
+        didPublish = true;
+    }
+
+    previousTimes.swap(currentTimes);
+    previousSeen.swap(currentSeen);
+    previousTimestampNs = timestampNs;
+    havePrevious = true;
+    return didPublish;
+}
+
+void Exs_CPUUsageSampler::publish(const Exs_CPUTimeBreakdown& total,
+                                  const std::vector<Exs_CPUTimeBreakdown>& cpus, uint64 intervalNs) {
+    // Write the buffer readers are not directed to, then flip
+    uint32 target = 1 - published.load(std::memory_order_relaxed);
+    Exs_CPUUsageBuffer& buffer = *buffers[target];
+
+    uint32 version = buffer.version.load(std::memory_order_relaxed);
+    buffer.version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    buffer.sequence = sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+    buffer.intervalNs = intervalNs;
+    buffer.total = total;
+    memcpy(buffer.cpus.data(), cpus.data(), cpus.size() * sizeof(Exs_CPUTimeBreakdown));
+
+    buffer.version.store(version + 2, std::memory_order_release);
+    published.store(target, std::memory_order_release);
+}
+
+bool Exs_CPUUsageSampler::getSnapshot(Exs_CPUUsageSnapshot& snapshot) const {
+    if (sequence.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    snapshot.cpus.resize(cpuCapacity);
+    while (true) {
+        const Exs_CPUUsageBuffer& buffer = *buffers[published.load(std::memory_order_acquire)];
+
+        uint32 before = buffer.version.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+
+        snapshot.sequence = buffer.sequence;
+        snapshot.intervalNs = buffer.intervalNs;
+        snapshot.total = buffer.total;
+        memcpy(snapshot.cpus.data(), buffer.cpus.data(), buffer.cpus.size() * sizeof(Exs_CPUTimeBreakdown));
+
+        // A changed version means the writer reused this buffer meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32 after = buffer.version.load(std::memory_order_relaxed);
+        if (before == after) {
+            return true;
+        }
+    }
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,176 @@
+// src/Core/Platform/Linux/CacheTopologyLinux.cpp
+#include "../internal/CacheTopology.h"
+#include "SysfsLinux.h"
+#include <sched.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+
+static std::vector<Exs_CacheDomain> Exs_BuildCacheDomains() {
+    std::vector<Exs_CacheDomain> domains;
+    std::vector<uint32> online = Platform::Exs_GetOnlineCPUs();
+
+    for (uint32 cpu : online) {
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+
+        for (uint32 index = 0; index < 16; index++) {
+            std::string dir = base + std::to_string(index) + "/";
+            uint64 level = 0;
+            if (!Exs_ReadSysfsUInt64(dir + "level", level)) {
+                break;
+            }
+
+            std::string type = Exs_ReadSysfsString(dir + "type");
+            std::vector<uint32> shared = Platform::Exs_ParseCPUList(
+                Exs_ReadSysfsString(dir + "shared_cpu_list").c_str());
+
+            // Offline CPUs are listed as sharers too
+            std::vector<uint32> cpus;
+            for (uint32 sharer : shared) {
+                if (std::binary_search(online.begin(), online.end(), sharer)) {
+                    cpus.push_back(sharer);
+                }
+            }
+            if (cpus.empty()) {
+                cpus.push_back(cpu);
+            }
+
+            // Described once, by the lowest online sharer
+            if (cpus.front() != cpu) {
+                continue;
+            }
+
+            Exs_CacheDomain domain = {};
+            domain.index = static_cast<uint32>(domains.size());
+            domain.level = static_cast<uint32>(level);
+            domain.type = type;
+            domain.cpus = cpus;
+
+            uint64 value = 0;
+            domain.instanceId = Exs_ReadSysfsUInt64(dir + "id", value) ? static_cast<uint32>(value) : domain.index;
+            domain.lineSize = Exs_ReadSysfsUInt64(dir + "coherency_line_size", value) ? static_cast<uint32>(value) : 0;
+            domain.associativity = Exs_ReadSysfsUInt64(dir + "ways_of_associativity", value) ? static_cast<uint32>(value) : 0;
+
+            std::string size = Exs_ReadSysfsString(dir + "size");
+            uint64 sizeValue = strtoull(size.c_str(), nullptr, 10);
+            if (!size.empty() && size.back() == 'M') {
+                sizeValue *= 1024;
+            }
+            domain.sizeKB = static_cast<uint32>(sizeValue);
+
+            domains.push_back(domain);
+        }
+    }
+
+    // Group by level, then by first CPU
+    std::stable_sort(domains.begin(), domains.end(), [](const Exs_CacheDomain& a, const Exs_CacheDomain& b) {
+        if (a.level != b.level) return a.level < b.level;
+        if (a.type != b.type) return a.type < b.type;
+        return a.cpus.front() < b.cpus.front();
+    });
+    for (size_t i = 0; i < domains.size(); i++) {
+        domains[i].index = static_cast<uint32>(i);
+    }
+    return domains;
+}
+
+const std::vector<Exs_CacheDomain>& Exs_GetCacheDomains() {
+    static const std::vector<Exs_CacheDomain> domains = Exs_BuildCacheDomains();
+    return domains;
+}
+
+static uint32 Exs_ResolveCacheLevel(uint32 level) {
+    if (level != 0) {
+        return level;
+    }
+    uint32 lastLevel = 0;
+    for (const Exs_CacheDomain& domain : Exs_GetCacheDomains()) {
+        lastLevel = std::max(lastLevel, domain.level);
+    }
+    return lastLevel;
+}
+
+std::vector<const Exs_CacheDomain*> Exs_GetCacheDomainsAtLevel(uint32 level) {
+    level = Exs_ResolveCacheLevel(level);
+
+    std::vector<const Exs_CacheDomain*> result;
+    for (const Exs_CacheDomain& domain : Exs_GetCacheDomains()) {
+        if (domain.level == level && domain.type != "Instruction") {
+            result.push_back(&domain);
+        }
+    }
+    return result;
+}
+
+const Exs_CacheDomain* Exs_GetCacheDomainOfCPU(uint32 cpu, uint32 level) {
+    for (const Exs_CacheDomain* domain : Exs_GetCacheDomainsAtLevel(level)) {
+        if (std::binary_search(domain->cpus.begin(), domain->cpus.end(), cpu)) {
+            return domain;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<Exs_CacheWorkPartition> Exs_PartitionWorkByCache(uint64 begin, uint64 end, uint32 level) {
+    std::vector<Exs_CacheWorkPartition> partitions;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool haveAffinity = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    uint64 totalCPUs = 0;
+    for (const Exs_CacheDomain* domain : Exs_GetCacheDomainsAtLevel(level)) {
+        Exs_CacheWorkPartition partition = {};
+        partition.domainIndex = domain->index;
+        for (uint32 cpu : domain->cpus) {
+            if (!haveAffinity || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                partition.cpus.push_back(cpu);
+            }
+        }
+        if (!partition.cpus.empty()) {
+            totalCPUs += partition.cpus.size();
+            partitions.push_back(partition);
+        }
+    }
+
+    if (begin >= end) {
+        for (Exs_CacheWorkPartition& partition : partitions) {
+            partition.begin = begin;
+            partition.end = begin;
+        }
+        return partitions;
+    }
+    if (partitions.empty()) {
+        return partitions;
+    }
+
+    // Proportional split; the last partition absorbs the rounding
+    uint64 count = end - begin;
+    uint64 cursor = begin;
+    uint64 cpusSoFar = 0;
+    for (Exs_CacheWorkPartition& partition : partitions) {
+        cpusSoFar += partition.cpus.size();
+        uint64 partitionEnd = begin + static_cast<uint64>(
+            static_cast<double>(count) * static_cast<double>(cpusSoFar) / static_cast<double>(totalCPUs));
+        partition.begin = cursor;
+        partition.end = std::max(cursor, std::min(partitionEnd, end));
+        cursor = partition.end;
+    }
+    partitions.back().end = end;
+
+    return partitions;
+}
+
+bool Exs_PinCurrentThreadToCacheDomain(const Exs_CacheDomain& domain) {
+    return Platform::Exs_PinCurrentThreadToCPUs(domain.cpus);
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,245 @@
+// src/Core/Platform/Linux/CoreFrequencyLinux.cpp
+#include "../internal/CoreFrequency.h"
+#include "SysfsLinux.h"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+constexpr uint64 kExs_MSR_IA32_MPERF = 0xE7;
+constexpr uint64 kExs_MSR_IA32_APERF = 0xE8;
+
+// Per-CPU descriptors and the previous counter values
+struct Exs_CoreFrequencyCounter {
+    int fd = -1;       // msr device, perf group leader, or scaling_cur_freq
+    int memberFd = -1; // perf mperf event
+    Exs_FrequencyCounterState state;
+};
+
+uint32 Exs_UpdateFrequencyCounter(Exs_FrequencyCounterState& state, uint64 aperf, uint64 mperf,
+                                  uint32 baseFrequencyMHz) {
+    if (state.havePrevious && mperf == state.lastMPERF) {
+        return state.lastEffectiveMHz;
+    }
+
+    uint32 effectiveMHz = 0;
+    if (state.havePrevious && mperf > state.lastMPERF && aperf >= state.lastAPERF) {
+        double ratio = static_cast<double>(aperf - state.lastAPERF) /
+                       static_cast<double>(mperf - state.lastMPERF);
+        effectiveMHz = static_cast<uint32>(ratio * baseFrequencyMHz + 0.5);
+        state.lastEffectiveMHz = effectiveMHz;
+    }
+    state.lastAPERF = aperf;
+    state.lastMPERF = mperf;
+    state.havePrevious = true;
+    return effectiveMHz;
+}
+
+// Reads the perf "msr" PMU event config, e.g. "event=0x01"
+static bool Exs_ReadPerfMSREvent(const char* name, uint64& config) {
+    std::string text = Platform::Exs_ReadSysfsString(
+        std::string("/sys/bus/event_source/devices/msr/events/") + name);
+    const char* value = strstr(text.c_str(), "event=");
+    if (value == nullptr) {
+        return false;
+    }
+    config = strtoull(value + 6, nullptr, 0);
+    return true;
+}
+
+Exs_CoreFrequencySampler::Exs_CoreFrequencySampler(const std::vector<uint32>& cpus, uint32 baseFrequencyMHz)
+    : cpus(cpus), baseFrequencyMHz(baseFrequencyMHz), source(Exs_FrequencySource::None),
+      havePrevious(false), haveResult(false), lastSweepNs(0), counters(cpus.size()) {
+    // The counter sources are only meaningful with a known base frequency
+    if (baseFrequencyMHz != 0 && openMSR()) {
+        source = Exs_FrequencySource::MSR;
+    } else if (baseFrequencyMHz != 0 && openPerfMSR()) {
+        source = Exs_FrequencySource::PerfMSR;
+    } else if (openCpufreq()) {
+        source = Exs_FrequencySource::Cpufreq;
+    }
+
+    // Baseline counts, so that the first query already has an interval
+    if (source == Exs_FrequencySource::MSR || source == Exs_FrequencySource::PerfMSR) {
+        sweep();
+    }
+}
+
+Exs_CoreFrequencySampler::~Exs_CoreFrequencySampler() {
+    for (Exs_CoreFrequencyCounter& counter : counters) {
+        if (counter.memberFd >= 0) {
+            close(counter.memberFd);
+        }
+        if (counter.fd >= 0) {
+            close(counter.fd);
+        }
+    }
+}
+
+bool Exs_CoreFrequencySampler::openMSR() {
+    for (size_t i = 0; i < cpus.size(); i++) {
+        std::string path = "/dev/cpu/" + std::to_string(cpus[i]) + "/msr";
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        uint64 value = 0;
+        if (fd < 0 || pread(fd, &value, sizeof(value), kExs_MSR_IA32_APERF) != sizeof(value)) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            for (size_t j = 0; j < i; j++) {
+                close(counters[j].fd);
+                counters[j].fd = -1;
+            }
+            return false;
+        }
+        counters[i].fd = fd;
+    }
+    return !cpus.empty();
+}
+
+bool Exs_CoreFrequencySampler::openPerfMSR() {
+    uint64 type = 0, aperf = 0, mperf = 0;
+    if (!Platform::Exs_ReadSysfsUInt64("/sys/bus/event_source/devices/msr/type", type) ||
+        !Exs_ReadPerfMSREvent("aperf", aperf) || !Exs_ReadPerfMSREvent("mperf", mperf)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < cpus.size(); i++) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = static_cast<uint32>(type);
+        attr.read_format = PERF_FORMAT_GROUP;
+
+        // System-wide per-CPU events: needs CAP_PERFMON or perf_event_paranoid <= 0
+        attr.config = aperf;
+        int leader = static_cast<int>(syscall(SYS_perf_event_open, &attr, -1, static_cast<int>(cpus[i]), -1,
+                                              PERF_FLAG_FD_CLOEXEC));
+        int member = -1;
+        if (leader >= 0) {
+            attr.config = mperf;
+            member = static_cast<int>(syscall(SYS_perf_event_open, &attr, -1, static_cast<int>(cpus[i]), leader,
+                                              PERF_FLAG_FD_CLOEXEC));
+        }
+
+        if (member < 0) {
+            if (leader >= 0) {
+                close(leader);
+            }
+            for (size_t j = 0; j < i; j++) {
+                close(counters[j].memberFd);
+                close(counters[j].fd);
+                counters[j].fd = -1;
+                counters[j].memberFd = -1;
+            }
+            return false;
+        }
+
+        counters[i].fd = leader;
+        counters[i].memberFd = member;
+    }
+    return !cpus.empty();
+}
+
+bool Exs_CoreFrequencySampler::openCpufreq() {
+    bool any = false;
+    for (size_t i = 0; i < cpus.size(); i++) {
+        std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpus[i]) + "/cpufreq/scaling_cur_freq";
+        counters[i].fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        any = any || counters[i].fd >= 0;
+    }
+    return any;
+}
+
+Exs_FrequencySource Exs_CoreFrequencySampler::getSource() const {
+    return source;
+}
+
+void Exs_CoreFrequencySampler::sweep() {
+    latest.resize(cpus.size());
+
+    for (size_t i = 0; i < cpus.size(); i++) {
+        Exs_CoreFrequencyCounter& counter = counters[i];
+        Exs_CoreFrequencySample& sample = latest[i];
+        sample.cpu = cpus[i];
+        sample.effectiveMHz = 0;
+        sample.valid = false;
+
+        uint64 aperf = 0, mperf = 0;
+        bool read = false;
+
+        switch (source) {
+            case Exs_FrequencySource::MSR:
+                read = pread(counter.fd, &aperf, sizeof(aperf), kExs_MSR_IA32_APERF) == sizeof(aperf) &&
+                       pread(counter.fd, &mperf, sizeof(mperf), kExs_MSR_IA32_MPERF) == sizeof(mperf);
+                break;
+
+            case Exs_FrequencySource::PerfMSR: {
+                // PERF_FORMAT_GROUP without times: nr, aperf, mperf
+                uint64 buffer[3] = {0};
+                read = ::read(counter.fd, buffer, sizeof(buffer)) == sizeof(buffer) && buffer[0] == 2;
+                aperf = buffer[1];
+                mperf = buffer[2];
+                break;
+            }
+
+            case Exs_FrequencySource::Cpufreq: {
+                char buffer[24];
+                ssize_t bytes = counter.fd >= 0 ? pread(counter.fd, buffer, sizeof(buffer) - 1, 0) : -1;
+                if (bytes > 0) {
+                    buffer[bytes] = '\0';
+                    sample.effectiveMHz = static_cast<uint32>(strtoull(buffer, nullptr, 10) / 1000);
+                    sample.valid = true;
+                }
+                continue;
+            }
+
+            case Exs_FrequencySource::None:
+                continue;
+        }
+
+        if (!read) {
+            continue;
+        }
+
+        sample.effectiveMHz = Exs_UpdateFrequencyCounter(counter.state, aperf, mperf, baseFrequencyMHz);
+        sample.valid = sample.effectiveMHz != 0;
+    }
+
+    haveResult = havePrevious;
+    havePrevious = true;
+    lastSweepNs = Platform::Exs_GetMonotonicNanoseconds();
+}
+
+bool Exs_CoreFrequencySampler::sample(std::vector<Exs_CoreFrequencySample>& samples, uint32 minIntervalMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (source == Exs_FrequencySource::None) {
+        samples.clear();
+        return false;
+    }
+
+    if (source != Exs_FrequencySource::Cpufreq) {
+        if (!havePrevious) {
+            sweep();
+        }
+
+        if (Platform::Exs_KeepLastSample(lastSweepNs, minIntervalMs, haveResult)) {
+            samples = latest;
+            return true;
+        }
+    }
+
+    sweep();
+    samples = latest;
+    return true;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
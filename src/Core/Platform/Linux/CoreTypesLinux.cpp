@@ -0,0 +1,208 @@
+// src/Core/Platform/Linux/CoreTypesLinux.cpp
+#include "../internal/CoreTypes.h"
+#include "../internal/CPUFeatureSet.h"
+#include "../internal/CPUID.h"
+#include "SysfsLinux.h"
+#include <algorithm>
+#include <thread>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+using Platform::Exs_ParseCPUList;
+
+// Intel hybrid parts register one PMU per core type, each listing its CPUs
+static bool Exs_ClassifyByHybridPMU(std::vector<Exs_CoreTypeInfo>& types) {
+    std::vector<uint32> performance = Exs_ParseCPUList(
+        Exs_ReadSysfsString("/sys/devices/cpu_core/cpus").c_str());
+    std::vector<uint32> efficiency = Exs_ParseCPUList(
+        Exs_ReadSysfsString("/sys/devices/cpu_atom/cpus").c_str());
+    if (performance.empty() || efficiency.empty()) {
+        return false;
+    }
+
+    for (Exs_CoreTypeInfo& info : types) {
+        if (std::binary_search(performance.begin(), performance.end(), info.cpu)) {
+            info.type = Exs_CPUCoreType::Performance;
+        } else if (std::binary_search(efficiency.begin(), efficiency.end(), info.cpu)) {
+            info.type = Exs_CPUCoreType::Efficiency;
+        }
+    }
+    return true;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// Leaf 0x1A describes the CPU executing it, so each CPU is visited by a
+// short-lived helper thread; the caller's affinity is left alone
+static bool Exs_ClassifyByCPUID(std::vector<Exs_CoreTypeInfo>& types) {
+    if (Exs_GetMaxCPUIDLeaf(0) < 0x1A || !Exs_GetCPUFeatureSet().has(Exs_CPUFeature::HYBRID)) {
+        return false;
+    }
+
+    bool any = false;
+    std::thread worker([&types, &any]() {
+        for (Exs_CoreTypeInfo& info : types) {
+            if (!Platform::Exs_PinCurrentThreadToCPUs({ info.cpu })) {
+                continue;
+            }
+
+            uint32 registers[4] = {0};
+            Exs_ReadCPUID(0x1A, 0, registers);
+            switch (registers[0] >> 24) {
+                case 0x20: // Intel Atom
+                    info.type = Exs_CPUCoreType::Efficiency;
+                    any = true;
+                    break;
+                case 0x40: // Intel Core
+                    info.type = Exs_CPUCoreType::Performance;
+                    any = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+    });
+    worker.join();
+    return any;
+}
+#endif
+
+// Scheduler capacities (0-1024) are exported on ARM and RISC-V; distinct
+// values mean a heterogeneous layout. The fastest tier is Performance, every
+// slower tier (mid and little cores alike) is Efficiency, as on Windows.
+static bool Exs_ReadCapacities(std::vector<Exs_CoreTypeInfo>& types) {
+    for (Exs_CoreTypeInfo& info : types) {
+        uint64 value = 0;
+        if (!Exs_ReadSysfsUInt64("/sys/devices/system/cpu/cpu" + std::to_string(info.cpu) + "/cpu_capacity", value) ||
+            value == 0) {
+            return false;
+        }
+        info.capacity = static_cast<uint32>(value);
+    }
+    return !types.empty();
+}
+
+static void Exs_ClassifyByCapacity(std::vector<Exs_CoreTypeInfo>& types) {
+    uint32 highest = types.front().capacity;
+    for (const Exs_CoreTypeInfo& info : types) {
+        highest = std::max(highest, info.capacity);
+    }
+    for (Exs_CoreTypeInfo& info : types) {
+        info.type = info.capacity < highest ? Exs_CPUCoreType::Efficiency : Exs_CPUCoreType::Performance;
+    }
+}
+
+// Maximum frequency relative to the fastest CPU, for parts that classify
+// cores but do not export scheduler capacities
+static void Exs_EstimateCapacities(std::vector<Exs_CoreTypeInfo>& types) {
+    std::vector<uint64> frequencies(types.size(), 0);
+    uint64 fastest = 0;
+    for (size_t i = 0; i < types.size(); i++) {
+        Exs_ReadSysfsUInt64("/sys/devices/system/cpu/cpu" + std::to_string(types[i].cpu) + "/cpufreq/cpuinfo_max_freq",
+                            frequencies[i]);
+        fastest = std::max(fastest, frequencies[i]);
+    }
+
+    for (size_t i = 0; i < types.size(); i++) {
+        if (fastest != 0 && frequencies[i] != 0) {
+            types[i].capacity = static_cast<uint32>(std::max<uint64>(1, frequencies[i] * 1024 / fastest));
+        } else {
+            // Class known, speed not: one equal step per class, as on Windows
+            types[i].capacity = types[i].type == Exs_CPUCoreType::Performance ? 1024 : 512;
+        }
+    }
+}
+
+struct Exs_CoreTypeTable {
+    std::vector<Exs_CoreTypeInfo> types;
+    Exs_CoreTypeSource source = Exs_CoreTypeSource::None;
+};
+
+static Exs_CoreTypeTable Exs_BuildCoreTypeTable() {
+    Exs_CoreTypeTable table;
+    for (uint32 cpu : Platform::Exs_GetOnlineCPUs()) {
+        table.types.push_back({ cpu, Exs_CPUCoreType::Unknown, 0 });
+    }
+    if (table.types.empty()) {
+        return table;
+    }
+
+    bool haveCapacities = Exs_ReadCapacities(table.types);
+
+    if (Exs_ClassifyByHybridPMU(table.types)) {
+        table.source = Exs_CoreTypeSource::HybridPMU;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    else if (Exs_ClassifyByCPUID(table.types)) {
+        table.source = Exs_CoreTypeSource::CPUID;
+    }
+#endif
+    else if (haveCapacities) {
+        Exs_ClassifyByCapacity(table.types);
+        bool mixed = std::any_of(table.types.begin(), table.types.end(), [](const Exs_CoreTypeInfo& info) {
+            return info.type == Exs_CPUCoreType::Efficiency;
+        });
+        if (mixed) {
+            table.source = Exs_CoreTypeSource::Capacity;
+        }
+    }
+
+    if (table.source == Exs_CoreTypeSource::None) {
+        // Homogeneous: every core is a performance core
+        for (Exs_CoreTypeInfo& info : table.types) {
+            info.type = Exs_CPUCoreType::Performance;
+            info.capacity = 1024;
+        }
+    } else if (!haveCapacities) {
+        Exs_EstimateCapacities(table.types);
+    }
+
+    return table;
+}
+
+static const Exs_CoreTypeTable& Exs_GetCoreTypeTable() {
+    static const Exs_CoreTypeTable table = Exs_BuildCoreTypeTable();
+    return table;
+}
+
+const std::vector<Exs_CoreTypeInfo>& Exs_GetCoreTypes() {
+    return Exs_GetCoreTypeTable().types;
+}
+
+Exs_CoreTypeSource Exs_GetCoreTypeSource() {
+    return Exs_GetCoreTypeTable().source;
+}
+
+bool Exs_IsHybridCPU() {
+    return !Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Performance).empty() &&
+           !Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Efficiency).empty();
+}
+
+const Exs_CoreTypeInfo* Exs_GetCoreTypeOfCPU(uint32 cpu) {
+    const std::vector<Exs_CoreTypeInfo>& types = Exs_GetCoreTypes();
+    auto it = std::lower_bound(types.begin(), types.end(), cpu, [](const Exs_CoreTypeInfo& info, uint32 value) {
+        return info.cpu < value;
+    });
+    return it != types.end() && it->cpu == cpu ? &*it : nullptr;
+}
+
+std::vector<uint32> Exs_GetCPUsOfCoreType(Exs_CPUCoreType type) {
+    std::vector<uint32> cpus;
+    for (const Exs_CoreTypeInfo& info : Exs_GetCoreTypes()) {
+        if (info.type == type) {
+            cpus.push_back(info.cpu);
+        }
+    }
+    return cpus;
+}
+
+bool Exs_PinCurrentThreadToCoreType(Exs_CPUCoreType type) {
+    return Platform::Exs_PinCurrentThreadToCPUs(Exs_GetCPUsOfCoreType(type));
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,183 @@
+// src/Core/Platform/Linux/CounterScopeLinux.cpp
+#include "../internal/CounterScope.h"
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// One region of one thread. Only the owning thread writes counts, with plain
+// load/store pairs; collectors read them concurrently. Baselines belong to
+// the collector side and are only touched under the registry mutex.
+struct Exs_CounterRegionEntry {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64> calls{0};
+    std::atomic<uint64> values[kExs_PerfCounterEventCount] = {};
+
+    uint64 baselineCalls = 0;
+    uint64 baselineValues[kExs_PerfCounterEventCount] = {};
+};
+
+struct Exs_CounterThreadTable {
+    Exs_PerfCounterGroup counters{Exs_PerfCounterScope::Thread};
+    Exs_CounterRegionEntry entries[kExs_MaxCounterRegionsPerThread];
+
+    Exs_CounterThreadTable();
+    ~Exs_CounterThreadTable();
+
+    // Owner only; nullptr when the table is full
+    Exs_CounterRegionEntry* find(const char* name) {
+        uint32 hash = static_cast<uint32>((reinterpret_cast<uintptr_t>(name) >> 3) * 0x9E3779B1u);
+        for (uint32 probe = 0; probe < kExs_MaxCounterRegionsPerThread; probe++) {
+            Exs_CounterRegionEntry& entry = entries[(hash + probe) % kExs_MaxCounterRegionsPerThread];
+            const char* entryName = entry.name.load(std::memory_order_relaxed);
+            if (entryName == name) {
+                return &entry;
+            }
+            if (entryName == nullptr) {
+                entry.name.store(name, std::memory_order_release);
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// Live tables plus the totals of threads that have exited
+struct Exs_CounterRegistry {
+    std::mutex mutex;
+    std::vector<Exs_CounterThreadTable*> tables;
+    std::map<std::string, Exs_CounterRegionStats> retired;
+};
+
+static Exs_CounterRegistry& Exs_GetCounterRegistry() {
+    // Leaked on purpose: thread tables may unregister during static destruction
+    static Exs_CounterRegistry* registry = new Exs_CounterRegistry();
+    return *registry;
+}
+
+static void Exs_AddEntryToStats(Exs_CounterRegionEntry& entry, const char* name,
+                                std::map<std::string, Exs_CounterRegionStats>& stats) {
+    Exs_CounterRegionStats& region = stats[name];
+    region.name = name;
+    region.calls += entry.calls.load(std::memory_order_relaxed) - entry.baselineCalls;
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        region.values[i] += entry.values[i].load(std::memory_order_relaxed) - entry.baselineValues[i];
+    }
+}
+
+Exs_CounterThreadTable::Exs_CounterThreadTable() {
+    Exs_CounterRegistry& registry = Exs_GetCounterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.tables.push_back(this);
+}
+
+Exs_CounterThreadTable::~Exs_CounterThreadTable() {
+    Exs_CounterRegistry& registry = Exs_GetCounterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (Exs_CounterRegionEntry& entry : entries) {
+        const char* name = entry.name.load(std::memory_order_acquire);
+        if (name != nullptr) {
+            Exs_AddEntryToStats(entry, name, registry.retired);
+        }
+    }
+
+    registry.tables.erase(std::remove(registry.tables.begin(), registry.tables.end(), this),
+                          registry.tables.end());
+}
+
+static Exs_CounterThreadTable& Exs_GetCounterThreadTable() {
+    static thread_local Exs_CounterThreadTable table;
+    return table;
+}
+
+Exs_CounterScope::Exs_CounterScope(const char* name)
+    : name(name), table(&Exs_GetCounterThreadTable()) {
+    if (!table->counters.readUnscaled(start)) {
+        table = nullptr;
+    }
+}
+
+Exs_CounterScope::~Exs_CounterScope() {
+    if (table == nullptr) {
+        return;
+    }
+
+    uint64 end[kExs_PerfCounterEventCount];
+    if (!table->counters.readUnscaled(end)) {
+        return;
+    }
+
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        end[i] -= start[i];
+    }
+    Exs_RecordCounterRegion(name, end);
+}
+
+void Exs_RecordCounterRegion(const char* name, const uint64 deltas[kExs_PerfCounterEventCount]) {
+    Exs_CounterRegionEntry* entry = Exs_GetCounterThreadTable().find(name);
+    if (entry == nullptr) {
+        return;
+    }
+
+    entry->calls.store(entry->calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        uint64 value = entry->values[i].load(std::memory_order_relaxed);
+        entry->values[i].store(value + deltas[i], std::memory_order_relaxed);
+    }
+}
+
+std::vector<Exs_CounterRegionStats> Exs_CollectCounterRegions() {
+    Exs_CounterRegistry& registry = Exs_GetCounterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::map<std::string, Exs_CounterRegionStats> merged = registry.retired;
+    for (Exs_CounterThreadTable* table : registry.tables) {
+        for (Exs_CounterRegionEntry& entry : table->entries) {
+            const char* name = entry.name.load(std::memory_order_acquire);
+            if (name != nullptr) {
+                Exs_AddEntryToStats(entry, name, merged);
+            }
+        }
+    }
+
+    std::vector<Exs_CounterRegionStats> regions;
+    regions.reserve(merged.size());
+    for (auto& pair : merged) {
+        regions.push_back(pair.second);
+    }
+
+    std::sort(regions.begin(), regions.end(),
+              [](const Exs_CounterRegionStats& a, const Exs_CounterRegionStats& b) {
+        return a.get(Exs_PerfCounterEvent::Cycles) > b.get(Exs_PerfCounterEvent::Cycles);
+    });
+    return regions;
+}
+
+void Exs_ResetCounterRegions() {
+    Exs_CounterRegistry& registry = Exs_GetCounterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Owners keep counting; the current totals become the new zero
+    registry.retired.clear();
+    for (Exs_CounterThreadTable* table : registry.tables) {
+        for (Exs_CounterRegionEntry& entry : table->entries) {
+            if (entry.name.load(std::memory_order_acquire) == nullptr) {
+                continue;
+            }
+            entry.baselineCalls = entry.calls.load(std::memory_order_relaxed);
+            for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+                entry.baselineValues[i] = entry.values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,200 @@
+// src/Core/Platform/Linux/HugePageMemoryLinux.cpp
+#include "../internal/HugePageMemory.h"
+#include "../internal/ProcessMemoryMaps.h"
+#include "SysfsLinux.h"
+#include <sys/mman.h>
+#include <dirent.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <algorithm>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+using Platform::Exs_GetBasePageSize;
+
+static constexpr uint64 kExs_THPSize = 2ULL * 1024 * 1024;
+
+static uint64 Exs_RoundUp(uint64 value, uint64 alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::vector<Exs_HugePagePoolInfo> Exs_GetHugePagePools() {
+    std::vector<Exs_HugePagePoolInfo> pools;
+
+    DIR* dir = opendir("/sys/kernel/mm/hugepages");
+    if (dir == nullptr) {
+        return pools;
+    }
+
+    // Entries are named hugepages-<size>kB
+    while (struct dirent* entry = readdir(dir)) {
+        if (strncmp(entry->d_name, "hugepages-", 10) != 0) {
+            continue;
+        }
+
+        std::string base = std::string("/sys/kernel/mm/hugepages/") + entry->d_name + "/";
+
+        Exs_HugePagePoolInfo pool = {};
+        pool.pageSizeBytes = strtoull(entry->d_name + 10, nullptr, 10) * 1024;
+        Exs_ReadSysfsUInt64(base + "nr_hugepages", pool.totalPages);
+        Exs_ReadSysfsUInt64(base + "free_hugepages", pool.freePages);
+        Exs_ReadSysfsUInt64(base + "resv_hugepages", pool.reservedPages);
+        Exs_ReadSysfsUInt64(base + "surplus_hugepages", pool.surplusPages);
+        pools.push_back(pool);
+    }
+    closedir(dir);
+
+    std::sort(pools.begin(), pools.end(),
+              [](const Exs_HugePagePoolInfo& a, const Exs_HugePagePoolInfo& b) {
+        return a.pageSizeBytes < b.pageSizeBytes;
+    });
+    return pools;
+}
+
+Exs_TransparentHugePageMode Exs_GetTransparentHugePageMode() {
+    // Format: "always [madvise] never", the bracketed value is active
+    std::string setting = Exs_ReadSysfsString("/sys/kernel/mm/transparent_hugepage/enabled");
+    if (setting.find("[always]") != std::string::npos) return Exs_TransparentHugePageMode::Always;
+    if (setting.find("[madvise]") != std::string::npos) return Exs_TransparentHugePageMode::Madvise;
+    if (setting.find("[never]") != std::string::npos) return Exs_TransparentHugePageMode::Never;
+    return Exs_TransparentHugePageMode::Unknown;
+}
+
+static bool Exs_TryExplicitHugePages(uint64 size, uint64 pageSize, Exs_LargeRegion& region) {
+    // MAP_HUGETLB encodes log2(page size) in the flag bits above MAP_HUGE_SHIFT
+    int log2PageSize = __builtin_ctzll(pageSize);
+    uint64 mappedSize = Exs_RoundUp(size, pageSize);
+
+    void* address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                         (log2PageSize << MAP_HUGE_SHIFT),
+                         -1, 0);
+    if (address == MAP_FAILED) {
+        return false;
+    }
+
+    region.address = address;
+    region.size = mappedSize;
+    region.pageSizeBytes = pageSize;
+    region.backing = Exs_LargeRegionBacking::ExplicitHuge;
+    return true;
+}
+
+Exs_LargeRegion Exs_AllocateLargeRegion(uint64 size, uint64 preferredPageSize) {
+    Exs_LargeRegion region = { nullptr, 0, 0, Exs_LargeRegionBacking::None };
+    if (size == 0) {
+        return region;
+    }
+
+    // Explicit pools first: the requested size, or the smallest that fits
+    for (const auto& pool : Exs_GetHugePagePools()) {
+        if (preferredPageSize != 0 && pool.pageSizeBytes != preferredPageSize) {
+            continue;
+        }
+
+        uint64 pagesNeeded = Exs_RoundUp(size, pool.pageSizeBytes) / pool.pageSizeBytes;
+        uint64 available = pool.freePages > pool.reservedPages
+            ? pool.freePages - pool.reservedPages
+            : 0;
+        if (pagesNeeded <= available &&
+            Exs_TryExplicitHugePages(size, pool.pageSizeBytes, region)) {
+            return region;
+        }
+    }
+
+    // Transparent huge pages: over-map so the region can start on a 2MB boundary
+    uint64 mappedSize = Exs_RoundUp(size, kExs_THPSize);
+    if (Exs_GetTransparentHugePageMode() != Exs_TransparentHugePageMode::Never) {
+        uint64 reserveSize = mappedSize + kExs_THPSize;
+        void* reserved = mmap(nullptr, reserveSize, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved != MAP_FAILED) {
+            uintptr_t start = reinterpret_cast<uintptr_t>(reserved);
+            uintptr_t aligned = static_cast<uintptr_t>(Exs_RoundUp(start, kExs_THPSize));
+            uintptr_t end = aligned + mappedSize;
+
+            if (aligned > start) {
+                munmap(reserved, aligned - start);
+            }
+            if (start + reserveSize > end) {
+                munmap(reinterpret_cast<void*>(end), start + reserveSize - end);
+            }
+
+            region.address = reinterpret_cast<void*>(aligned);
+            region.size = mappedSize;
+
+            if (madvise(region.address, mappedSize, MADV_HUGEPAGE) == 0) {
+                region.pageSizeBytes = kExs_THPSize;
+                region.backing = Exs_LargeRegionBacking::TransparentHuge;
+            } else {
+                region.pageSizeBytes = Exs_GetBasePageSize();
+                region.backing = Exs_LargeRegionBacking::BasePages;
+            }
+            return region;
+        }
+    }
+
+    // Base pages
+    mappedSize = Exs_RoundUp(size, Exs_GetBasePageSize());
+    void* address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address != MAP_FAILED) {
+        region.address = address;
+        region.size = mappedSize;
+        region.pageSizeBytes = Exs_GetBasePageSize();
+        region.backing = Exs_LargeRegionBacking::BasePages;
+    }
+    return region;
+}
+
+void Exs_FreeLargeRegion(Exs_LargeRegion& region) {
+    if (region.address != nullptr && region.size != 0) {
+        munmap(region.address, region.size);
+    }
+    region.address = nullptr;
+    region.size = 0;
+    region.backing = Exs_LargeRegionBacking::None;
+}
+
+Exs_LargeRegionResidency Exs_GetLargeRegionResidency(const Exs_LargeRegion& region) {
+    Exs_LargeRegionResidency residency = { 0, 0, 0.0 };
+    if (region.address == nullptr) {
+        return residency;
+    }
+
+    uint64 regionStart = reinterpret_cast<uintptr_t>(region.address);
+    uint64 regionEnd = regionStart + region.size;
+
+    // The kernel may split the region into several VMAs; sum every one inside it
+    bool ok = Exs_ForEachMapping(0, Exs_MappingDetail::Full, [&](const Exs_MappingInfo& mapping) {
+        if (mapping.start >= regionEnd || mapping.end <= regionStart) {
+            return;
+        }
+        // hugetlb pages are not included in Rss
+        residency.residentBytes += mapping.counters.rss + mapping.counters.hugetlb;
+        residency.hugePageBytes += mapping.counters.anonHugePages + mapping.counters.hugetlb;
+    });
+    if (!ok) {
+        return residency;
+    }
+
+    if (residency.residentBytes > 0) {
+        residency.hugePageFraction = static_cast<double>(residency.hugePageBytes) /
+                                     static_cast<double>(residency.residentBytes);
+    }
+    return residency;
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,165 @@
+// src/Core/Platform/Linux/MemInfoReaderLinux.cpp
+#include "../internal/MemInfoReader.h"
+#include "SysfsLinux.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <string_view>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+constexpr std::string_view kExs_MemInfoKeys[] = {
+    "MemTotal", "MemFree", "MemAvailable", "Buffers", "Cached", "SwapCached", "Active", "Inactive",
+    "Unevictable", "Mlocked", "SwapTotal", "SwapFree", "Dirty", "Writeback", "AnonPages", "Mapped",
+    "Shmem", "KReclaimable", "Slab", "SReclaimable", "SUnreclaim", "KernelStack", "PageTables",
+    "CommitLimit", "Committed_AS", "AnonHugePages", "ShmemHugePages", "FileHugePages",
+    "HugePages_Total", "HugePages_Free", "HugePages_Rsvd", "HugePages_Surp", "Hugepagesize",
+    "Hugetlb", "MemUsed"
+};
+
+static_assert(sizeof(kExs_MemInfoKeys) / sizeof(kExs_MemInfoKeys[0]) == kExs_MemInfoFieldCount,
+              "meminfo keys out of sync with Exs_MemInfoField");
+
+// Line hint values: 0 = not seen yet, field + 1, or a line we do not keep
+constexpr uint8 kExs_MemInfoHintUnknown = 0;
+constexpr uint8 kExs_MemInfoHintSkip = 0xFF;
+
+static uint32 Exs_FindMemInfoKey(std::string_view key) {
+    for (uint32 field = 0; field < kExs_MemInfoFieldCount; field++) {
+        if (kExs_MemInfoKeys[field] == key) {
+            return field;
+        }
+    }
+    return kExs_MemInfoFieldCount;
+}
+
+bool Exs_ParseMemInfo(const char* buffer, size_t length, Exs_MemInfoValues& values,
+                      uint8* lineHints, uint32 lineHintCount) {
+    memset(&values, 0, sizeof(values));
+
+    bool layoutChanged = false;
+    const char* cursor = buffer;
+    const char* end = buffer + length;
+    for (uint32 line = 0; cursor < end; line++) {
+        const char* lineEnd = static_cast<const char*>(memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+
+        // Per-node files prefix every line with "Node N "
+        const char* key = cursor;
+        if (lineEnd - key > 5 && memcmp(key, "Node ", 5) == 0) {
+            key += 5;
+            while (key < lineEnd && *key >= '0' && *key <= '9') key++;
+            while (key < lineEnd && *key == ' ') key++;
+        }
+
+        const char* colon = static_cast<const char*>(memchr(key, ':', static_cast<size_t>(lineEnd - key)));
+        uint8* hint = lineHints != nullptr && line < lineHintCount ? &lineHints[line] : nullptr;
+
+        if (colon != nullptr && (hint == nullptr || *hint != kExs_MemInfoHintSkip)) {
+            std::string_view name(key, static_cast<size_t>(colon - key));
+
+            // The layout is fixed per kernel, so the hint almost always matches
+            uint32 field = kExs_MemInfoFieldCount;
+            if (hint != nullptr && *hint != kExs_MemInfoHintUnknown && kExs_MemInfoKeys[*hint - 1] == name) {
+                field = *hint - 1u;
+            } else {
+                field = Exs_FindMemInfoKey(name);
+                layoutChanged = layoutChanged || (hint != nullptr && *hint != kExs_MemInfoHintUnknown);
+                if (hint != nullptr) {
+                    *hint = field < kExs_MemInfoFieldCount ? static_cast<uint8>(field + 1) : kExs_MemInfoHintSkip;
+                }
+            }
+
+            if (field < kExs_MemInfoFieldCount) {
+                const char* digit = colon + 1;
+                while (digit < lineEnd && *digit == ' ') digit++;
+
+                uint64 value = 0;
+                while (digit < lineEnd && *digit >= '0' && *digit <= '9') {
+                    value = value * 10 + static_cast<uint64>(*digit - '0');
+                    digit++;
+                }
+                if (lineEnd - digit >= 3 && memcmp(digit, " kB", 3) == 0) {
+                    value *= 1024;
+                }
+
+                values.values[field] = value;
+                values.present |= 1ULL << field;
+            }
+        }
+
+        cursor = lineEnd + 1;
+    }
+
+    // A moved key may now sit on a line hinted as skipped; relearn from scratch
+    if (layoutChanged) {
+        memset(lineHints, kExs_MemInfoHintUnknown, lineHintCount);
+        return Exs_ParseMemInfo(buffer, length, values, lineHints, lineHintCount);
+    }
+
+    return values.present != 0;
+}
+
+Exs_MemInfoReader::Exs_MemInfoReader(const char* path, uint32 maxAgeMs)
+    : fd(open(path, O_RDONLY | O_CLOEXEC)), maxAgeMs(maxAgeMs), lastReadNs(0), valid(false) {
+    memset(&cached, 0, sizeof(cached));
+    memset(lineHints, 0, sizeof(lineHints));
+}
+
+Exs_MemInfoReader::~Exs_MemInfoReader() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+bool Exs_MemInfoReader::isOpen() const {
+    return fd >= 0;
+}
+
+bool Exs_MemInfoReader::read(Exs_MemInfoValues& values) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (fd < 0) {
+        return false;
+    }
+
+    uint64 now = Platform::Exs_GetMonotonicNanoseconds();
+    if (valid && maxAgeMs != 0 && now - lastReadNs < static_cast<uint64>(maxAgeMs) * 1000000ULL) {
+        values = cached;
+        return true;
+    }
+
+    // procfs renders the whole file on the first read, so one pread is a full snapshot
+    ssize_t bytes = pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (bytes <= 0) {
+        return false;
+    }
+    buffer[bytes] = '\0';
+
+    if (!Exs_ParseMemInfo(buffer, static_cast<size_t>(bytes), cached, lineHints, kLineHintCount)) {
+        valid = false;
+        return false;
+    }
+
+    valid = true;
+    lastReadNs = now;
+    values = cached;
+    return true;
+}
+
+void Exs_MemInfoReader::setMaxAge(uint32 maxAgeMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->maxAgeMs = maxAgeMs;
+}
+
+uint32 Exs_MemInfoReader::getMaxAge() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxAgeMs;
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
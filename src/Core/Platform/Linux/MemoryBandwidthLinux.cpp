@@ -0,0 +1,439 @@
+// src/Core/Platform/Linux/MemoryBandwidthLinux.cpp
+#include "../internal/MemoryBandwidth.h"
+#include "../internal/HugePageMemory.h"
+#include "../internal/TopologyTree.h"
+#include "../internal/CacheTopology.h"
+#include "../internal/ThreadPool.h"
+#include "SysfsLinux.h"
+#include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_DispatchTarget;
+
+constexpr double kExs_StreamScalar = 3.0;
+constexpr uint64 kExs_StreamMinArrayBytes = 32ULL * 1024 * 1024;
+constexpr uint64 kExs_StreamAlignElements = 8; // one cache line of doubles
+
+static const uint64 kExs_StreamBytesPerElement[kExs_StreamKernelCount] = { 16, 16, 24, 24 };
+
+// Also finishes the unaligned tails of the vector variants
+static void Exs_StreamScalarKernel(Exs_StreamKernel kernel, double* a, const double* b, const double* c,
+                                   double scalar, uint64 count, bool) {
+    switch (kernel) {
+        case Exs_StreamKernel::Copy:
+            for (uint64 i = 0; i < count; i++) a[i] = b[i];
+            break;
+        case Exs_StreamKernel::Scale:
+            for (uint64 i = 0; i < count; i++) a[i] = scalar * b[i];
+            break;
+        case Exs_StreamKernel::Add:
+            for (uint64 i = 0; i < count; i++) a[i] = b[i] + c[i];
+            break;
+        case Exs_StreamKernel::Triad:
+            for (uint64 i = 0; i < count; i++) a[i] = b[i] + scalar * c[i];
+            break;
+        case Exs_StreamKernel::Count:
+            break;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// Streaming stores bypass the caches, so the destination is not read for ownership
+
+static inline void Exs_StreamStoreSSE2(double* p, __m128d v, bool nonTemporal) {
+    if (nonTemporal) _mm_stream_pd(p, v); else _mm_store_pd(p, v);
+}
+
+static void Exs_StreamSSE2Kernel(Exs_StreamKernel kernel, double* a, const double* b, const double* c,
+                                 double scalar, uint64 count, bool nonTemporal) {
+    __m128d s = _mm_set1_pd(scalar);
+    uint64 vectorEnd = count & ~1ULL;
+    uint64 i = 0;
+    switch (kernel) {
+        case Exs_StreamKernel::Copy:
+            for (; i < vectorEnd; i += 2) Exs_StreamStoreSSE2(a + i, _mm_load_pd(b + i), nonTemporal);
+            break;
+        case Exs_StreamKernel::Scale:
+            for (; i < vectorEnd; i += 2) Exs_StreamStoreSSE2(a + i, _mm_mul_pd(s, _mm_load_pd(b + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Add:
+            for (; i < vectorEnd; i += 2)
+                Exs_StreamStoreSSE2(a + i, _mm_add_pd(_mm_load_pd(b + i), _mm_load_pd(c + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Triad:
+            for (; i < vectorEnd; i += 2)
+                Exs_StreamStoreSSE2(a + i, _mm_add_pd(_mm_load_pd(b + i), _mm_mul_pd(s, _mm_load_pd(c + i))),
+                                    nonTemporal);
+            break;
+        case Exs_StreamKernel::Count:
+            break;
+    }
+    if (nonTemporal) {
+        _mm_sfence();
+    }
+    Exs_StreamScalarKernel(kernel, a + i, b + i, c + i, scalar, count - i, false);
+}
+
+__attribute__((target("avx2")))
+static inline void Exs_StreamStoreAVX2(double* p, __m256d v, bool nonTemporal) {
+    if (nonTemporal) _mm256_stream_pd(p, v); else _mm256_store_pd(p, v);
+}
+
+__attribute__((target("avx2")))
+static void Exs_StreamAVX2Kernel(Exs_StreamKernel kernel, double* a, const double* b, const double* c,
+                                 double scalar, uint64 count, bool nonTemporal) {
+    __m256d s = _mm256_set1_pd(scalar);
+    uint64 vectorEnd = count & ~3ULL;
+    uint64 i = 0;
+    switch (kernel) {
+        case Exs_StreamKernel::Copy:
+            for (; i < vectorEnd; i += 4) Exs_StreamStoreAVX2(a + i, _mm256_load_pd(b + i), nonTemporal);
+            break;
+        case Exs_StreamKernel::Scale:
+            for (; i < vectorEnd; i += 4)
+                Exs_StreamStoreAVX2(a + i, _mm256_mul_pd(s, _mm256_load_pd(b + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Add:
+            for (; i < vectorEnd; i += 4)
+                Exs_StreamStoreAVX2(a + i, _mm256_add_pd(_mm256_load_pd(b + i), _mm256_load_pd(c + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Triad:
+            for (; i < vectorEnd; i += 4)
+                Exs_StreamStoreAVX2(a + i, _mm256_add_pd(_mm256_load_pd(b + i), _mm256_mul_pd(s, _mm256_load_pd(c + i))),
+                                    nonTemporal);
+            break;
+        case Exs_StreamKernel::Count:
+            break;
+    }
+    if (nonTemporal) {
+        _mm_sfence();
+    }
+    Exs_StreamScalarKernel(kernel, a + i, b + i, c + i, scalar, count - i, false);
+}
+
+__attribute__((target("avx512f")))
+static inline void Exs_StreamStoreAVX512(double* p, __m512d v, bool nonTemporal) {
+    if (nonTemporal) _mm512_stream_pd(p, v); else _mm512_store_pd(p, v);
+}
+
+__attribute__((target("avx512f")))
+static void Exs_StreamAVX512Kernel(Exs_StreamKernel kernel, double* a, const double* b, const double* c,
+                                   double scalar, uint64 count, bool nonTemporal) {
+    __m512d s = _mm512_set1_pd(scalar);
+    uint64 vectorEnd = count & ~7ULL;
+    uint64 i = 0;
+    switch (kernel) {
+        case Exs_StreamKernel::Copy:
+            for (; i < vectorEnd; i += 8) Exs_StreamStoreAVX512(a + i, _mm512_load_pd(b + i), nonTemporal);
+            break;
+        case Exs_StreamKernel::Scale:
+            for (; i < vectorEnd; i += 8)
+                Exs_StreamStoreAVX512(a + i, _mm512_mul_pd(s, _mm512_load_pd(b + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Add:
+            for (; i < vectorEnd; i += 8)
+                Exs_StreamStoreAVX512(a + i, _mm512_add_pd(_mm512_load_pd(b + i), _mm512_load_pd(c + i)), nonTemporal);
+            break;
+        case Exs_StreamKernel::Triad:
+            for (; i < vectorEnd; i += 8)
+                Exs_StreamStoreAVX512(a + i, _mm512_add_pd(_mm512_load_pd(b + i), _mm512_mul_pd(s, _mm512_load_pd(c + i))),
+                                      nonTemporal);
+            break;
+        case Exs_StreamKernel::Count:
+            break;
+    }
+    if (nonTemporal) {
+        _mm_sfence();
+    }
+    Exs_StreamScalarKernel(kernel, a + i, b + i, c + i, scalar, count - i, false);
+}
+#endif
+
+// On AArch64 the scalar loops are auto-vectorized to NEON
+static Platform::Exs_CPUDispatch<void(Exs_StreamKernel, double*, const double*, const double*, double, uint64, bool)>
+    s_streamKernel("stream", {
+        { Exs_DispatchTarget::Scalar, &Exs_StreamScalarKernel },
+#if defined(__x86_64__) || defined(__i386__)
+        { Exs_DispatchTarget::SSE2, &Exs_StreamSSE2Kernel },
+        { Exs_DispatchTarget::AVX2, &Exs_StreamAVX2Kernel },
+        { Exs_DispatchTarget::AVX512, &Exs_StreamAVX512Kernel },
+#endif
+    });
+
+static inline void Exs_StreamRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// Generation-counting spin barrier; every thread owns a core, so spinning keeps
+// the start and stop of a repetition within a few hundred nanoseconds
+class Exs_StreamBarrier {
+public:
+    explicit Exs_StreamBarrier(uint32 count) : count(count) {}
+
+    void wait() {
+        uint32 generation = this->generation.load(std::memory_order_acquire);
+        if (arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+            arrived.store(0, std::memory_order_relaxed);
+            this->generation.fetch_add(1, std::memory_order_release);
+            return;
+        }
+        for (uint32 spins = 0; this->generation.load(std::memory_order_acquire) == generation; spins++) {
+            if (spins < 4096) {
+                Exs_StreamRelax();
+            } else {
+                sched_yield();
+            }
+        }
+    }
+
+private:
+    const uint32 count;
+    std::atomic<uint32> arrived{0};
+    std::atomic<uint32> generation{0};
+};
+
+// One run: the arrays are first-touched by the thread that streams each
+// slice, so with the default local policy every slice lives on its thread's node
+static bool Exs_RunStream(const std::vector<uint32>& cpus, uint64 elements, const Exs_StreamOptions& options,
+                          Exs_StreamRunResult& result) {
+    result.threads = static_cast<uint32>(cpus.size());
+    result.cpus = cpus;
+    if (cpus.empty() || elements == 0) {
+        return false;
+    }
+
+    Exs_LargeRegion regions[3];
+    bool allocated = true;
+    for (Exs_LargeRegion& region : regions) {
+        region = Exs_AllocateLargeRegion(elements * sizeof(double));
+        allocated = allocated && region.backing != Exs_LargeRegionBacking::None;
+    }
+    if (!allocated) {
+        for (Exs_LargeRegion& region : regions) {
+            Exs_FreeLargeRegion(region);
+        }
+        return false;
+    }
+
+    double* a = static_cast<double*>(regions[0].address);
+    double* b = static_cast<double*>(regions[1].address);
+    double* c = static_cast<double*>(regions[2].address);
+
+    uint32 threadCount = static_cast<uint32>(cpus.size());
+    uint32 runs = options.repetitions + 1;
+    std::vector<double> seconds(static_cast<size_t>(runs) * kExs_StreamKernelCount, 0.0);
+    Exs_StreamBarrier barrier(threadCount);
+
+    auto worker = [&](uint32 index) {
+        Platform::Exs_PinCurrentThreadToCPU(cpus[index]);
+
+        // Slices start on cache-line boundaries so the aligned vector paths apply
+        uint64 begin = elements * index / threadCount / kExs_StreamAlignElements * kExs_StreamAlignElements;
+        uint64 end = index + 1 == threadCount
+            ? elements
+            : elements * (index + 1) / threadCount / kExs_StreamAlignElements * kExs_StreamAlignElements;
+        uint64 count = end - begin;
+
+        for (uint64 i = begin; i < end; i++) {
+            a[i] = 1.0;
+            b[i] = 2.0;
+            c[i] = 0.0;
+        }
+
+        for (uint32 run = 0; run < runs; run++) {
+            for (uint32 kernel = 0; kernel < kExs_StreamKernelCount; kernel++) {
+                barrier.wait();
+                uint64 startNs = index == 0 ? Platform::Exs_GetMonotonicNanoseconds() : 0;
+
+                // STREAM's order: c = a, b = s*c, c = a + b, a = b + s*c
+                switch (static_cast<Exs_StreamKernel>(kernel)) {
+                    case Exs_StreamKernel::Copy:
+                        s_streamKernel(Exs_StreamKernel::Copy, c + begin, a + begin, a + begin,
+                                       kExs_StreamScalar, count, options.nonTemporalStores);
+                        break;
+                    case Exs_StreamKernel::Scale:
+                        s_streamKernel(Exs_StreamKernel::Scale, b + begin, c + begin, c + begin,
+                                       kExs_StreamScalar, count, options.nonTemporalStores);
+                        break;
+                    case Exs_StreamKernel::Add:
+                        s_streamKernel(Exs_StreamKernel::Add, c + begin, a + begin, b + begin,
+                                       kExs_StreamScalar, count, options.nonTemporalStores);
+                        break;
+                    case Exs_StreamKernel::Triad:
+                        s_streamKernel(Exs_StreamKernel::Triad, a + begin, b + begin, c + begin,
+                                       kExs_StreamScalar, count, options.nonTemporalStores);
+                        break;
+                    case Exs_StreamKernel::Count:
+                        break;
+                }
+
+                barrier.wait();
+                if (index == 0) {
+                    uint64 elapsedNs = Platform::Exs_GetMonotonicNanoseconds() - startNs;
+                    seconds[static_cast<size_t>(run) * kExs_StreamKernelCount + kernel] = static_cast<double>(elapsedNs) * 1e-9;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (uint32 index = 0; index < threadCount; index++) {
+        threads.emplace_back(worker, index);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // The first run pays for page faults and is dropped, as in STREAM
+    for (uint32 kernel = 0; kernel < kExs_StreamKernelCount; kernel++) {
+        Exs_StreamKernelResult& kernelResult = result.kernels[kernel];
+        kernelResult = {};
+
+        double bytes = static_cast<double>(kExs_StreamBytesPerElement[kernel] * elements);
+        double sum = 0.0, sumSquares = 0.0;
+        uint32 samples = 0;
+        for (uint32 run = runs > 1 ? 1 : 0; run < runs; run++) {
+            double time = seconds[static_cast<size_t>(run) * kExs_StreamKernelCount + kernel];
+            if (time <= 0.0) {
+                continue;
+            }
+            double gbps = bytes / time / 1e9;
+            sum += gbps;
+            sumSquares += gbps * gbps;
+            samples++;
+            if (gbps > kernelResult.bestGBps) {
+                kernelResult.bestGBps = gbps;
+                kernelResult.bestSeconds = time;
+            }
+        }
+        if (samples > 0) {
+            kernelResult.meanGBps = sum / samples;
+            double variance = sumSquares / samples - kernelResult.meanGBps * kernelResult.meanGBps;
+            kernelResult.stddevGBps = variance > 0.0 ? std::sqrt(variance) : 0.0;
+        }
+    }
+
+    for (Exs_LargeRegion& region : regions) {
+        Exs_FreeLargeRegion(region);
+    }
+    return true;
+}
+
+// STREAM's rule: each array at least four times the caches, within a
+// quarter of free memory for all three
+static uint64 Exs_GetStreamElements(const Exs_StreamOptions& options) {
+    uint64 arrayBytes = options.arrayBytes;
+    if (arrayBytes == 0) {
+        uint64 lastLevelBytes = 0;
+        for (const CPUInfo::Exs_CacheDomain* domain : CPUInfo::Exs_GetCacheDomainsAtLevel(0)) {
+            lastLevelBytes += static_cast<uint64>(domain->sizeKB) * 1024;
+        }
+        arrayBytes = std::max(kExs_StreamMinArrayBytes, lastLevelBytes * 4);
+
+        long freePages = sysconf(_SC_AVPHYS_PAGES);
+        if (freePages > 0) {
+            uint64 budget = static_cast<uint64>(freePages) * Platform::Exs_GetBasePageSize() / 4 / 3;
+            arrayBytes = std::min(arrayBytes, std::max(budget, kExs_StreamMinArrayBytes));
+        }
+    }
+    return arrayBytes / sizeof(double) / kExs_StreamAlignElements * kExs_StreamAlignElements;
+}
+
+struct Exs_StreamNodeCPUs {
+    uint32 node;
+    std::vector<uint32> cpus;
+};
+
+// First PU of every core this process may run on, grouped by NUMA node
+static std::vector<Exs_StreamNodeCPUs> Exs_GetStreamCPUs(uint32 threadsPerNode) {
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool haveAffinity = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    std::vector<Exs_StreamNodeCPUs> nodes;
+    const CPUInfo::Exs_TopologyNode& tree = CPUInfo::Exs_GetTopologyTree();
+    for (const CPUInfo::Exs_TopologyNode* numa : CPUInfo::Exs_GetTopologyNodes(tree, CPUInfo::Exs_TopologyNodeType::NumaNode)) {
+        // A node split across packages shows up once per package
+        auto it = std::find_if(nodes.begin(), nodes.end(), [&](const Exs_StreamNodeCPUs& entry) {
+            return entry.node == numa->id;
+        });
+        if (it == nodes.end()) {
+            nodes.push_back({ numa->id, {} });
+            it = nodes.end() - 1;
+        }
+
+        for (const CPUInfo::Exs_TopologyNode* core : CPUInfo::Exs_GetTopologyNodes(*numa, CPUInfo::Exs_TopologyNodeType::Core)) {
+            for (uint32 cpu : core->cpus) {
+                if (!haveAffinity || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                    it->cpus.push_back(cpu);
+                    break;
+                }
+            }
+        }
+    }
+
+    for (Exs_StreamNodeCPUs& entry : nodes) {
+        std::sort(entry.cpus.begin(), entry.cpus.end());
+        if (threadsPerNode != 0 && entry.cpus.size() > threadsPerNode) {
+            entry.cpus.resize(threadsPerNode);
+        }
+    }
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](const Exs_StreamNodeCPUs& entry) {
+        return entry.cpus.empty();
+    }), nodes.end());
+    return nodes;
+}
+
+Exs_StreamReport Exs_MeasureMemoryBandwidth(const Exs_StreamOptions& options) {
+    Exs_StreamReport report = {};
+    report.target = s_streamKernel.selectedTarget();
+    report.repetitions = options.repetitions;
+    report.nonTemporalStores = options.nonTemporalStores;
+
+    uint64 elements = Exs_GetStreamElements(options);
+    report.arrayBytes = elements * sizeof(double);
+
+    std::vector<Exs_StreamNodeCPUs> nodes = Exs_GetStreamCPUs(options.threadsPerNode);
+
+    std::vector<uint32> allCPUs;
+    for (const Exs_StreamNodeCPUs& entry : nodes) {
+        allCPUs.insert(allCPUs.end(), entry.cpus.begin(), entry.cpus.end());
+    }
+    std::sort(allCPUs.begin(), allCPUs.end());
+
+    report.system.node = kExs_StreamAllNodes;
+    Exs_RunStream(allCPUs, elements, options, report.system);
+
+    if (options.perNode) {
+        for (const Exs_StreamNodeCPUs& entry : nodes) {
+            Exs_StreamRunResult result = {};
+            result.node = entry.node;
+            if (Exs_RunStream(entry.cpus, elements, options, result)) {
+                report.nodes.push_back(result);
+            }
+        }
+    }
+
+    return report;
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,210 @@
+// src/Core/Platform/Linux/MemoryFragmentationLinux.cpp
+#include "../internal/MemoryFragmentation.h"
+#include "SysfsLinux.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_ReadSysfsFile;
+using Platform::Exs_ReadSysfsUInt64;
+using Platform::Exs_GetBasePageSize;
+
+constexpr uint64 kExs_DefaultHugePageBytes = 2 * 1024 * 1024;
+constexpr size_t kExs_FragmentationTextSize = 16384; // a few lines per node and zone
+
+// Order of a PMD-sized huge page, the size THP and hugetlb allocate most
+static uint32 Exs_GetHugePageOrder(uint64 pageSize) {
+    uint64 hugePageBytes = 0;
+    if (!Exs_ReadSysfsUInt64("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", hugePageBytes) ||
+        hugePageBytes < pageSize) {
+        hugePageBytes = kExs_DefaultHugePageBytes;
+    }
+
+    uint32 order = 0;
+    while ((pageSize << (order + 1)) <= hugePageBytes) {
+        order++;
+    }
+    return order;
+}
+
+// Fills the summary fields from freeBlocks, as mm/vmstat.c does for its
+// unusable_index and extfrag_index files
+static void Exs_SummarizeBuddyZone(Exs_BuddyZoneInfo& zone, uint32 hugePageOrder, uint64 pageSize) {
+    uint64 totalBlocks = 0;
+    zone.freePages = 0;
+    zone.hugePageBlocks = 0;
+    zone.largestFreeBlockBytes = 0;
+
+    for (uint32 order = 0; order < zone.freeBlocks.size(); order++) {
+        uint64 blocks = zone.freeBlocks[order];
+        totalBlocks += blocks;
+        zone.freePages += blocks << order;
+        if (order >= hugePageOrder) {
+            zone.hugePageBlocks += blocks << (order - hugePageOrder);
+        }
+        if (blocks != 0) {
+            zone.largestFreeBlockBytes = pageSize << order;
+        }
+    }
+
+    if (zone.freePages == 0) {
+        zone.unusableIndex = 1.0;
+    } else {
+        uint64 usablePages = zone.hugePageBlocks << hugePageOrder;
+        zone.unusableIndex = static_cast<double>(zone.freePages - usablePages) / static_cast<double>(zone.freePages);
+    }
+
+    if (!zone.extfragFromKernel) {
+        uint64 requested = 1ULL << hugePageOrder;
+        if (totalBlocks == 0) {
+            zone.extfragIndex = 0.0;
+        } else if (zone.hugePageBlocks != 0) {
+            zone.extfragIndex = -1.0;
+        } else {
+            uint64 index = (1000 + zone.freePages * 1000 / requested) / totalBlocks;
+            zone.extfragIndex = (1000.0 - static_cast<double>(index)) / 1000.0;
+        }
+    }
+}
+
+// Parses "Node 0, zone   Normal" and returns the rest of the line
+static const char* Exs_ParseZonePrefix(const char* line, uint32& node, char* zone, size_t zoneSize) {
+    unsigned parsedNode = 0;
+    int consumed = 0;
+    char name[32];
+    if (sscanf(line, "Node %u, zone %31s%n", &parsedNode, name, &consumed) != 2) {
+        return nullptr;
+    }
+    node = parsedNode;
+    snprintf(zone, zoneSize, "%s", name);
+    return line + consumed;
+}
+
+// Copies the next line of text into line and advances text past it
+static bool Exs_NextLine(const char*& text, char* line, size_t lineSize) {
+    if (text == nullptr || *text == '\0') {
+        return false;
+    }
+
+    const char* newline = strchr(text, '\n');
+    size_t length = newline != nullptr ? static_cast<size_t>(newline - text) : strlen(text);
+    size_t copied = length < lineSize - 1 ? length : lineSize - 1;
+    memcpy(line, text, copied);
+    line[copied] = '\0';
+    text = newline != nullptr ? newline + 1 : text + length;
+    return true;
+}
+
+// Copies the hugePageOrder column of debugfs extfrag_index into matching zones
+static void Exs_ParseKernelExtfragIndex(const char* text, Exs_FragmentationReport& report) {
+    char line[512];
+    while (Exs_NextLine(text, line, sizeof(line))) {
+        uint32 node = 0;
+        char zone[32];
+        const char* cursor = Exs_ParseZonePrefix(line, node, zone, sizeof(zone));
+        if (!cursor) {
+            continue;
+        }
+
+        // Format: one "%d.%03d" value per order
+        double value = 0.0;
+        bool found = false;
+        for (uint32 order = 0; order <= report.hugePageOrder; order++) {
+            char* end = nullptr;
+            value = strtod(cursor, &end);
+            if (end == cursor) {
+                break;
+            }
+            cursor = end;
+            found = order == report.hugePageOrder;
+        }
+        if (!found) {
+            continue;
+        }
+
+        for (Exs_BuddyZoneInfo& info : report.zones) {
+            if (info.node == node && info.zone == zone) {
+                info.extfragIndex = value;
+                info.extfragFromKernel = true;
+            }
+        }
+    }
+}
+
+bool Exs_ParseFragmentationReport(const char* buddyText, const char* extfragText, Exs_FragmentationReport& report) {
+    if (report.pageSizeBytes == 0) {
+        report.pageSizeBytes = Exs_GetBasePageSize();
+    }
+    if (report.hugePageOrder == 0) {
+        report.hugePageOrder = Exs_GetHugePageOrder(report.pageSizeBytes);
+    }
+    report.zones.clear();
+    report.total = {};
+
+    // Format: "Node 0, zone   Normal    682    202 ..." with one count per order
+    char line[512];
+    while (Exs_NextLine(buddyText, line, sizeof(line))) {
+        Exs_BuddyZoneInfo zone = {};
+        char name[32];
+        const char* cursor = Exs_ParseZonePrefix(line, zone.node, name, sizeof(name));
+        if (!cursor) {
+            continue;
+        }
+        zone.zone = name;
+
+        for (;;) {
+            char* end = nullptr;
+            unsigned long long blocks = strtoull(cursor, &end, 10);
+            if (end == cursor) {
+                break;
+            }
+            zone.freeBlocks.push_back(blocks);
+            cursor = end;
+        }
+        report.zones.push_back(zone);
+    }
+
+    if (report.zones.empty()) {
+        return false;
+    }
+
+    Exs_ParseKernelExtfragIndex(extfragText, report);
+
+    for (Exs_BuddyZoneInfo& zone : report.zones) {
+        Exs_SummarizeBuddyZone(zone, report.hugePageOrder, report.pageSizeBytes);
+
+        if (report.total.freeBlocks.size() < zone.freeBlocks.size()) {
+            report.total.freeBlocks.resize(zone.freeBlocks.size(), 0);
+        }
+        for (size_t order = 0; order < zone.freeBlocks.size(); order++) {
+            report.total.freeBlocks[order] += zone.freeBlocks[order];
+        }
+    }
+    Exs_SummarizeBuddyZone(report.total, report.hugePageOrder, report.pageSizeBytes);
+    return true;
+}
+
+bool Exs_GetFragmentationReport(Exs_FragmentationReport& report) {
+    report = {};
+
+    char buddyText[kExs_FragmentationTextSize];
+    if (Exs_ReadSysfsFile("/proc/buddyinfo", buddyText, sizeof(buddyText)) <= 0) {
+        return false;
+    }
+
+    // Normally root only; missing leaves the computed index
+    char extfragText[kExs_FragmentationTextSize];
+    if (Exs_ReadSysfsFile("/sys/kernel/debug/extfrag/extfrag_index", extfragText, sizeof(extfragText)) <= 0) {
+        extfragText[0] = '\0';
+    }
+
+    return Exs_ParseFragmentationReport(buddyText, extfragText, report);
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,518 @@
+// src/Core/Platform/Linux/MemoryInfoLinux.cpp
+#include "../internal/MemoryInfoBase.h"
+#include "../internal/MemInfoReader.h"
+#include "../internal/CacheTopology.h"
+#include "../internal/MemoryBandwidth.h"
+#include "../internal/MemoryLatency.h"
+#include "../internal/NumaMemory.h"
+#include "../internal/MemoryPressure.h"
+#include "../internal/MemoryFragmentation.h"
+#include "../internal/ProcessMemoryMaps.h"
+#include "SysfsLinux.h"
+#include <dirent.h>
+#include <unistd.h>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_ReadSysfsFile;
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+
+// PSI avg10 levels above which pressure counts as high
+constexpr double kExs_HighPressureSomePercent = 10.0;
+constexpr double kExs_HighPressureFullPercent = 2.0;
+
+// EXS_MEMINFO_MAX_AGE_MS overrides how long one /proc/meminfo read is reused
+static uint32 Exs_GetMemInfoMaxAge() {
+    const char* value = getenv("EXS_MEMINFO_MAX_AGE_MS");
+    if (value == nullptr || value[0] == '\0') {
+        return kExs_MemInfoDefaultMaxAgeMs;
+    }
+    return static_cast<uint32>(strtoul(value, nullptr, 10));
+}
+
+// "VmRSS:    1252 kB" style value from /proc/self/status, in bytes
+static uint64 Exs_FindStatusValue(const char* status, const char* key) {
+    size_t keyLength = strlen(key);
+    for (const char* line = status; line != nullptr && *line != '\0';) {
+        if (strncmp(line, key, keyLength) == 0 && line[keyLength] == ':') {
+            return strtoull(line + keyLength + 1, nullptr, 10) * 1024;
+        }
+        line = strchr(line, '\n');
+        if (line != nullptr) {
+            line++;
+        }
+    }
+    return 0;
+}
+
+static Exs_MemoryType Exs_MemoryTypeFromSMBIOS(uint8 type) {
+    switch (type) {
+        case 0x12: return Exs_MemoryType::DDR;
+        case 0x13: return Exs_MemoryType::DDR2;
+        case 0x18: return Exs_MemoryType::DDR3;
+        case 0x1A: return Exs_MemoryType::DDR4;
+        case 0x1B: return Exs_MemoryType::LPDDR;
+        case 0x1C: return Exs_MemoryType::LPDDR2;
+        case 0x1D: return Exs_MemoryType::LPDDR3;
+        case 0x1E: return Exs_MemoryType::LPDDR4;
+        case 0x20: return Exs_MemoryType::HBM;
+        case 0x21: return Exs_MemoryType::HBM2;
+        case 0x22: return Exs_MemoryType::DDR5;
+        case 0x23: return Exs_MemoryType::LPDDR5;
+        default: return Exs_MemoryType::Unknown;
+    }
+}
+
+// String number index (1-based) of an SMBIOS structure; strings follow the formatted area
+static std::string Exs_GetSMBIOSString(const uint8* entry, size_t size, uint8 index) {
+    if (index == 0 || size < 2 || entry[1] >= size) {
+        return std::string();
+    }
+    const char* text = reinterpret_cast<const char*>(entry + entry[1]);
+    const char* end = reinterpret_cast<const char*>(entry + size);
+    for (uint8 current = 1; text < end && *text != '\0'; current++) {
+        size_t length = strnlen(text, static_cast<size_t>(end - text));
+        if (current == index) {
+            std::string value(text, length);
+            while (!value.empty() && value.back() == ' ') {
+                value.pop_back();
+            }
+            return value;
+        }
+        text += length + 1;
+    }
+    return std::string();
+}
+
+static uint16 Exs_ReadSMBIOSWord(const uint8* entry, size_t offset) {
+    return static_cast<uint16>(entry[offset] | (entry[offset + 1] << 8));
+}
+
+static uint32 Exs_ReadSMBIOSDword(const uint8* entry, size_t offset) {
+    return static_cast<uint32>(Exs_ReadSMBIOSWord(entry, offset)) |
+           (static_cast<uint32>(Exs_ReadSMBIOSWord(entry, offset + 2)) << 16);
+}
+
+// SMBIOS type 17 (Memory Device) entries exported by the dmi-sysfs driver; root only
+static std::vector<Exs_MemoryModuleInfo> Exs_ReadMemoryModules() {
+    std::vector<Exs_MemoryModuleInfo> modules;
+
+    for (uint32 instance = 0;; instance++) {
+        uint8 entry[512];
+        std::string path = "/sys/firmware/dmi/entries/17-" + std::to_string(instance) + "/raw";
+        int64 size = Exs_ReadSysfsFile(path.c_str(), reinterpret_cast<char*>(entry), sizeof(entry));
+        if (size < 0x15) {
+            break;
+        }
+        uint8 length = entry[1];
+
+        // Size: 0 = empty slot, 0x7FFF = see extended size, bit 15 = KB granularity
+        uint16 sizeField = Exs_ReadSMBIOSWord(entry, 0x0C);
+        uint64 capacity = 0;
+        if (sizeField == 0x7FFF && length >= 0x20) {
+            capacity = static_cast<uint64>(Exs_ReadSMBIOSDword(entry, 0x1C) & 0x7FFFFFFF) << 20;
+        } else if (sizeField != 0 && sizeField != 0xFFFF) {
+            capacity = (sizeField & 0x8000) ? static_cast<uint64>(sizeField & 0x7FFF) << 10
+                                            : static_cast<uint64>(sizeField) << 20;
+        }
+        if (capacity == 0) {
+            continue;
+        }
+
+        Exs_MemoryModuleInfo module = {};
+        module.slot = instance;
+        module.capacityBytes = capacity;
+        module.type = Exs_MemoryTypeFromSMBIOS(entry[0x12]);
+
+        uint16 totalWidth = Exs_ReadSMBIOSWord(entry, 0x08);
+        uint16 dataWidth = Exs_ReadSMBIOSWord(entry, 0x0A);
+        module.dataWidth = dataWidth != 0xFFFF ? dataWidth : 0;
+        module.isECC = totalWidth != 0xFFFF && dataWidth != 0xFFFF && totalWidth > dataWidth;
+
+        uint16 typeDetail = Exs_ReadSMBIOSWord(entry, 0x13);
+        module.isBuffered = (typeDetail & (1 << 13)) != 0; // registered
+
+        if (length >= 0x17) {
+            module.speedMHz = Exs_ReadSMBIOSWord(entry, 0x15);
+            if (module.speedMHz == 0xFFFF && length >= 0x58) {
+                module.speedMHz = Exs_ReadSMBIOSDword(entry, 0x54);
+            }
+        }
+        if (length >= 0x1B) {
+            module.manufacturer = Exs_GetSMBIOSString(entry, static_cast<size_t>(size), entry[0x17]);
+            module.serialNumber = Exs_GetSMBIOSString(entry, static_cast<size_t>(size), entry[0x18]);
+            module.partNumber = Exs_GetSMBIOSString(entry, static_cast<size_t>(size), entry[0x1A]);
+        }
+        if (length >= 0x1C) {
+            module.rankCount = entry[0x1B] & 0x0F;
+        }
+
+        modules.push_back(module);
+    }
+
+    return modules;
+}
+
+// Modules do not change while the process runs
+static const std::vector<Exs_MemoryModuleInfo>& Exs_GetMemoryModules() {
+    static const std::vector<Exs_MemoryModuleInfo> modules = Exs_ReadMemoryModules();
+    return modules;
+}
+
+class Exs_MemoryInfoLinux : public Exs_MemoryInfoBase {
+private:
+    // Kept-open /proc/meminfo; all system-wide getters share its cached values
+    mutable Exs_MemInfoReader memInfo;
+
+    // System-wide STREAM run, measured on first use
+    mutable std::once_flag bandwidthOnce;
+    mutable double bandwidthGBps = 0.0;
+    mutable std::once_flag latencyOnce;
+    mutable uint64 latencyNs = 0;
+
+public:
+    Exs_MemoryInfoLinux()
+        : memInfo("/proc/meminfo", Exs_GetMemInfoMaxAge()) {
+    }
+
+    virtual ~Exs_MemoryInfoLinux() = default;
+
+    uint64 getTotalPhysicalMemory() const override {
+        return readField(Exs_MemInfoField::MemTotal);
+    }
+
+    uint64 getAvailablePhysicalMemory() const override {
+        return readField(Exs_MemInfoField::MemAvailable);
+    }
+
+    uint64 getUsedPhysicalMemory() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        return values.get(Exs_MemInfoField::MemTotal) - getAvailable(values);
+    }
+
+    // Virtual memory is RAM plus swap, the space anonymous pages can live in
+    uint64 getTotalVirtualMemory() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        return values.get(Exs_MemInfoField::MemTotal) + values.get(Exs_MemInfoField::SwapTotal);
+    }
+
+    uint64 getAvailableVirtualMemory() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        return getAvailable(values) + values.get(Exs_MemInfoField::SwapFree);
+    }
+
+    uint64 getUsedVirtualMemory() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        uint64 total = values.get(Exs_MemInfoField::MemTotal) + values.get(Exs_MemInfoField::SwapTotal);
+        return total - getAvailable(values) - values.get(Exs_MemInfoField::SwapFree);
+    }
+
+    uint64 getTotalPageFile() const override {
+        return readField(Exs_MemInfoField::SwapTotal);
+    }
+
+    uint64 getAvailablePageFile() const override {
+        return readField(Exs_MemInfoField::SwapFree);
+    }
+
+    uint64 getUsedPageFile() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        return values.get(Exs_MemInfoField::SwapTotal) - values.get(Exs_MemInfoField::SwapFree);
+    }
+
+    std::vector<Exs_MemoryModuleInfo> getMemoryModules() const override {
+        return Exs_GetMemoryModules();
+    }
+
+    uint32 getMemoryModuleCount() const override {
+        return static_cast<uint32>(Exs_GetMemoryModules().size());
+    }
+
+    Exs_MemoryType getMemoryType() const override {
+        const auto& modules = Exs_GetMemoryModules();
+        if (!modules.empty()) {
+            return modules[0].type;
+        }
+        return Exs_MemoryType::Unknown;
+    }
+
+    uint32 getMemorySpeed() const override {
+        const auto& modules = Exs_GetMemoryModules();
+        if (!modules.empty()) {
+            return modules[0].speedMHz;
+        }
+        return 0;
+    }
+
+    Exs_MemoryUsageStats getMemoryUsageStats() const override {
+        Exs_MemoryUsageStats stats = {};
+
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return stats;
+        }
+
+        stats.totalPhysical = values.get(Exs_MemInfoField::MemTotal);
+        stats.availablePhysical = getAvailable(values);
+        stats.usedPhysical = stats.totalPhysical - stats.availablePhysical;
+        stats.totalPageFile = values.get(Exs_MemInfoField::SwapTotal);
+        stats.availablePageFile = values.get(Exs_MemInfoField::SwapFree);
+        stats.usedPageFile = stats.totalPageFile - stats.availablePageFile;
+        stats.totalVirtual = stats.totalPhysical + stats.totalPageFile;
+        stats.availableVirtual = stats.availablePhysical + stats.availablePageFile;
+        stats.usedVirtual = stats.totalVirtual - stats.availableVirtual;
+        stats.cached = values.get(Exs_MemInfoField::Cached) + values.get(Exs_MemInfoField::SReclaimable);
+        stats.buffered = values.get(Exs_MemInfoField::Buffers);
+        stats.shared = values.get(Exs_MemInfoField::Shmem);
+        stats.usagePercentage = stats.totalPhysical != 0
+            ? static_cast<double>(stats.usedPhysical) / stats.totalPhysical * 100.0
+            : 0.0;
+
+        return stats;
+    }
+
+    uint64 getL1CacheSize() const override {
+        return getCacheSize(1);
+    }
+
+    uint64 getL2CacheSize() const override {
+        return getCacheSize(2);
+    }
+
+    uint64 getL3CacheSize() const override {
+        return getCacheSize(3);
+    }
+
+    // EDAC counters of every memory controller
+    Exs_MemoryErrorInfo getMemoryErrorInfo() const override {
+        Exs_MemoryErrorInfo info = {};
+
+        for (uint32 controller = 0;; controller++) {
+            std::string base = "/sys/devices/system/edac/mc/mc" + std::to_string(controller) + "/";
+            uint64 correctable = 0, uncorrectable = 0;
+            if (!Exs_ReadSysfsUInt64(base + "ce_count", correctable)) {
+                break;
+            }
+            Exs_ReadSysfsUInt64(base + "ue_count", uncorrectable);
+            info.correctableErrors += correctable;
+            info.uncorrectableErrors += uncorrectable;
+        }
+
+        if (info.uncorrectableErrors > 0) {
+            info.lastErrorType = "Uncorrectable";
+        } else if (info.correctableErrors > 0) {
+            info.lastErrorType = "Correctable";
+        }
+
+        return info;
+    }
+
+    bool hasMemoryErrors() const override {
+        auto info = getMemoryErrorInfo();
+        return (info.correctableErrors > 0) || (info.uncorrectableErrors > 0);
+    }
+
+    uint64 getProcessMemoryUsage() const override {
+        return readProcessStatus("VmRSS");
+    }
+
+    uint64 getProcessPeakMemoryUsage() const override {
+        return readProcessStatus("VmHWM");
+    }
+
+    // Anonymous resident pages plus what of them went to swap
+    uint64 getProcessPrivateBytes() const override {
+        char status[4096];
+        if (Exs_ReadSysfsFile("/proc/self/status", status, sizeof(status)) <= 0) {
+            return 0;
+        }
+        return Exs_FindStatusValue(status, "RssAnon") + Exs_FindStatusValue(status, "VmSwap");
+    }
+
+    uint64 getProcessWorkingSet() const override {
+        return readProcessStatus("VmRSS");
+    }
+
+    // Address ranges only, so the kernel skips the smaps page-table walk
+    std::vector<std::pair<uint64, uint64>> getMemoryRegions() const override {
+        std::vector<std::pair<uint64, uint64>> regions;
+        Exs_ForEachMapping(0, Exs_MappingDetail::Ranges, [&regions](const Exs_MappingInfo& mapping) {
+            regions.push_back({ mapping.start, mapping.end });
+        });
+        return regions;
+    }
+
+    // STREAM triad over all cores in GB/s; the first call takes a few seconds
+    double getMemoryBandwidth() const override {
+        std::call_once(bandwidthOnce, [this]() {
+            Exs_StreamOptions options;
+            options.repetitions = 5;
+            options.perNode = false;
+            bandwidthGBps = Exs_MeasureMemoryBandwidth(options).system.get(Exs_StreamKernel::Triad).bestGBps;
+        });
+        return bandwidthGBps;
+    }
+
+    // Local DRAM load-to-use latency in ns from a huge-page pointer chase
+    uint64 getMemoryLatency() const override {
+        std::call_once(latencyOnce, [this]() {
+            Exs_LatencyOptions options;
+            options.basePages = false;
+            options.remoteNodes = false;
+            options.stepsPerOctave = 1;
+            options.loadsPerPoint = 1 << 20;
+            latencyNs = static_cast<uint64>(std::llround(Exs_MeasureMemoryLatency(options).getLocalMemoryNanoseconds()));
+        });
+        return latencyNs;
+    }
+
+    uint32 getNumaNodeCount() const override {
+        std::vector<uint32> nodes = Platform::Exs_ParseCPUList(
+            Exs_ReadSysfsString("/sys/devices/system/node/online").c_str());
+        return nodes.empty() ? 1 : static_cast<uint32>(nodes.size());
+    }
+
+    // Free memory of one node, as GetNumaAvailableMemoryNodeEx reports it
+    uint64 getNumaNodeMemory(uint32 node) const override {
+        Exs_NumaNodeInfo info;
+        if (!Exs_GetNumaNodeInfo(node, info)) {
+            return node == 0 ? getAvailablePhysicalMemory() : 0;
+        }
+        return info.freeBytes;
+    }
+
+    // PSI of our cgroup, else of the system; the usage proxy only without PSI
+    bool isMemoryPressureHigh() const override {
+        Exs_MemoryPressure pressure;
+        if (!readMemoryPressure(pressure)) {
+            return getMemoryUsageStats().usagePercentage > 90.0; // Over 90% usage
+        }
+        return pressure.some.avg10 >= kExs_HighPressureSomePercent ||
+               pressure.full.avg10 >= kExs_HighPressureFullPercent;
+    }
+
+    // "some" avg10 of the PSI file isMemoryPressureHigh reads
+    double getMemoryPressurePercentage() const override {
+        Exs_MemoryPressure pressure;
+        if (!readMemoryPressure(pressure)) {
+            return kExs_PressureUnavailable;
+        }
+        return pressure.some.avg10;
+    }
+
+    // Percent of free memory in blocks too small for a huge page
+    double getMemoryFragmentation() const override {
+        Exs_FragmentationReport report;
+        if (!Exs_GetFragmentationReport(report)) {
+            return 0.0;
+        }
+        return report.total.unusableIndex * 100.0;
+    }
+
+    uint64 getSwapSize() const override {
+        return getTotalPageFile();
+    }
+
+    uint64 getSwapUsed() const override {
+        return getUsedPageFile();
+    }
+
+    double getSwapUsagePercentage() const override {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values) || values.get(Exs_MemInfoField::SwapTotal) == 0) {
+            return 0.0;
+        }
+        uint64 total = values.get(Exs_MemInfoField::SwapTotal);
+        uint64 used = total - values.get(Exs_MemInfoField::SwapFree);
+        return static_cast<double>(used) / total * 100.0;
+    }
+
+    uint64 getCommitLimit() const override {
+        return readField(Exs_MemInfoField::CommitLimit);
+    }
+
+    uint64 getCommittedMemory() const override {
+        return readField(Exs_MemInfoField::Committed_AS);
+    }
+
+private:
+    // A container limit stalls us long before the host notices
+    static bool readMemoryPressure(Exs_MemoryPressure& pressure) {
+        return Exs_ReadMemoryPressure(Exs_PressureSource::Cgroup, pressure) ||
+               Exs_ReadMemoryPressure(Exs_PressureSource::System, pressure);
+    }
+
+    bool readMemInfo(Exs_MemInfoValues& values) const {
+        return memInfo.read(values);
+    }
+
+    uint64 readField(Exs_MemInfoField field) const {
+        Exs_MemInfoValues values;
+        if (!readMemInfo(values)) {
+            return 0;
+        }
+        return field == Exs_MemInfoField::MemAvailable ? getAvailable(values) : values.get(field);
+    }
+
+    // Kernels before 3.14 have no MemAvailable; estimate it the old way
+    static uint64 getAvailable(const Exs_MemInfoValues& values) {
+        if (values.has(Exs_MemInfoField::MemAvailable)) {
+            return values.get(Exs_MemInfoField::MemAvailable);
+        }
+        return values.get(Exs_MemInfoField::MemFree) + values.get(Exs_MemInfoField::Buffers) +
+               values.get(Exs_MemInfoField::Cached) + values.get(Exs_MemInfoField::SReclaimable);
+    }
+
+    static uint64 readProcessStatus(const char* key) {
+        char status[4096];
+        if (Exs_ReadSysfsFile("/proc/self/status", status, sizeof(status)) <= 0) {
+            return 0;
+        }
+        return Exs_FindStatusValue(status, key);
+    }
+
+    // Sum over all instances of a level, data and instruction alike
+    static uint64 getCacheSize(uint32 level) {
+        uint64 total = 0;
+        for (const CPUInfo::Exs_CacheDomain& domain : CPUInfo::Exs_GetCacheDomains()) {
+            if (domain.level == level) {
+                total += static_cast<uint64>(domain.sizeKB) * 1024;
+            }
+        }
+        return total;
+    }
+};
+
+// Factory function implementation
+Exs_MemoryInfoBase* Exs_CreateMemoryInfoInstance() {
+    return new Exs_MemoryInfoLinux();
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
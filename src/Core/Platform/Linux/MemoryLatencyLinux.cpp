@@ -0,0 +1,217 @@
+// src/Core/Platform/Linux/MemoryLatencyLinux.cpp
+#include "../internal/MemoryLatency.h"
+#include "../internal/HugePageMemory.h"
+#include "../internal/NumaMemory.h"
+#include "../internal/CacheTopology.h"
+#include "../internal/ThreadPool.h"
+#include "SysfsLinux.h"
+#include <sys/mman.h>
+#include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+constexpr uint64 kExs_LatencyLineSize = 64;
+constexpr uint64 kExs_LatencyMinMaxBytes = 1ULL << 30;
+
+// Links the first lineCount lines of buffer into one random cycle (Sattolo),
+// so every line is visited once per lap in an order no prefetcher can follow
+static void Exs_BuildLatencyChain(char* buffer, uint64 lineCount, std::vector<uint32>& order, std::mt19937_64& random) {
+    order.resize(lineCount);
+    for (uint64 i = 0; i < lineCount; i++) {
+        order[i] = static_cast<uint32>(i);
+    }
+    for (uint64 i = lineCount - 1; i > 0; i--) {
+        uint64 j = random() % i;
+        std::swap(order[i], order[j]);
+    }
+    for (uint64 i = 0; i < lineCount; i++) {
+        uint64 next = order[i];
+        *reinterpret_cast<char**>(buffer + i * kExs_LatencyLineSize) = buffer + next * kExs_LatencyLineSize;
+    }
+}
+
+// Each load's address comes from the previous load
+__attribute__((noinline))
+static char* Exs_ChaseLatencyChain(char* p, uint64 loads) {
+    for (uint64 i = 0; i < loads; i += 16) {
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+        p = *reinterpret_cast<char**>(p); p = *reinterpret_cast<char**>(p);
+    }
+    __asm__ __volatile__("" : : "r"(p) : "memory");
+    return p;
+}
+
+// Buffer of the requested page mode; base pages are kept out of THP explicitly
+static Exs_LargeRegion Exs_AllocateLatencyBuffer(uint64 size, Exs_LatencyPageMode mode) {
+    if (mode == Exs_LatencyPageMode::HugePages) {
+        return Exs_AllocateLargeRegion(size);
+    }
+
+    Exs_LargeRegion region = { nullptr, 0, 0, Exs_LargeRegionBacking::None };
+    uint64 basePage = Platform::Exs_GetBasePageSize();
+    uint64 mappedSize = (size + basePage - 1) / basePage * basePage;
+
+    void* address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED) {
+        return region;
+    }
+    madvise(address, mappedSize, MADV_NOHUGEPAGE);
+
+    region.address = address;
+    region.size = mappedSize;
+    region.pageSizeBytes = basePage;
+    region.backing = Exs_LargeRegionBacking::BasePages;
+    return region;
+}
+
+// Working-set sizes from min to max, stepsPerOctave per doubling, in whole lines
+static std::vector<uint64> Exs_GetLatencySizes(const Exs_LatencyOptions& options, uint64 maxBytes) {
+    std::vector<uint64> sizes;
+    uint32 steps = std::max<uint32>(options.stepsPerOctave, 1);
+    uint64 minBytes = std::max<uint64>(options.minBytes, kExs_LatencyLineSize * 2);
+
+    for (uint32 step = 0;; step++) {
+        double bytes = static_cast<double>(minBytes) * std::pow(2.0, static_cast<double>(step) / steps);
+        uint64 size = static_cast<uint64>(bytes) / kExs_LatencyLineSize * kExs_LatencyLineSize;
+        if (size > maxBytes) {
+            break;
+        }
+        if (sizes.empty() || size != sizes.back()) {
+            sizes.push_back(size);
+        }
+    }
+    return sizes;
+}
+
+static uint64 Exs_GetLatencyMaxBytes(const Exs_LatencyOptions& options) {
+    if (options.maxBytes != 0) {
+        return options.maxBytes;
+    }
+
+    uint64 lastLevelBytes = 0;
+    for (const CPUInfo::Exs_CacheDomain* domain : CPUInfo::Exs_GetCacheDomainsAtLevel(0)) {
+        lastLevelBytes += static_cast<uint64>(domain->sizeKB) * 1024;
+    }
+    uint64 maxBytes = std::max(kExs_LatencyMinMaxBytes, lastLevelBytes * 8);
+
+    // The buffer and its order table must leave most free memory alone
+    long freePages = sysconf(_SC_AVPHYS_PAGES);
+    if (freePages > 0) {
+        maxBytes = std::min(maxBytes, static_cast<uint64>(freePages) * Platform::Exs_GetBasePageSize() / 4);
+    }
+    return maxBytes;
+}
+
+static bool Exs_MeasureLatencyCurve(Exs_LatencyCurve& curve, const std::vector<uint64>& sizes,
+                                    const Exs_LatencyOptions& options) {
+    if (sizes.empty()) {
+        return false;
+    }
+
+    Exs_LargeRegion region = Exs_AllocateLatencyBuffer(sizes.back(), curve.pageMode);
+    if (region.backing == Exs_LargeRegionBacking::None) {
+        return false;
+    }
+    curve.hugePagesBacked = region.backing == Exs_LargeRegionBacking::TransparentHuge ||
+                            region.backing == Exs_LargeRegionBacking::ExplicitHuge;
+
+    if (curve.memoryNode != curve.cpuNode && 
+        !Exs_BindMemory(region.address, region.size, Exs_NumaPolicy::Bind, { curve.memoryNode })) {
+        Exs_FreeLargeRegion(region);
+        return false;
+    }
+
+    char* buffer = static_cast<char*>(region.address);
+    std::vector<uint32> order;
+    std::mt19937_64 random(0x5EED);
+
+    for (uint64 size : sizes) {
+        uint64 lineCount = size / kExs_LatencyLineSize;
+        Exs_BuildLatencyChain(buffer, lineCount, order, random);
+
+        // One lap (bounded) brings the set into the caches and TLBs it fits in
+        char* p = Exs_ChaseLatencyChain(buffer, std::min<uint64>(lineCount, options.loadsPerPoint));
+
+        uint64 loads = std::max<uint64>(options.loadsPerPoint / 16 * 16, 16);
+        uint64 start = Platform::Exs_GetMonotonicNanoseconds();
+        Exs_ChaseLatencyChain(p, loads);
+        uint64 elapsed = Platform::Exs_GetMonotonicNanoseconds() - start;
+
+        curve.points.push_back({ size, static_cast<double>(elapsed) / static_cast<double>(loads) });
+    }
+
+    Exs_FreeLargeRegion(region);
+    curve.levels = Exs_InferLatencyLevels(curve.points);
+    return true;
+}
+
+Exs_LatencyReport Exs_MeasureMemoryLatency(const Exs_LatencyOptions& options) {
+    Exs_LatencyReport report;
+
+    // Measure from the first CPU this process may use
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    uint32 cpu = 0;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        while (cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &allowed)) {
+            cpu++;
+        }
+    }
+    uint32 cpuNode = Exs_GetNumaNodeOfCPU(cpu);
+
+    std::vector<uint32> memoryNodes = { cpuNode };
+    if (options.remoteNodes) {
+        for (uint32 node : Exs_GetNumaMemoryNodes()) {
+            if (node != cpuNode) {
+                memoryNodes.push_back(node);
+            }
+        }
+    }
+
+    std::vector<Exs_LatencyPageMode> modes;
+    if (options.hugePages) {
+        modes.push_back(Exs_LatencyPageMode::HugePages);
+    }
+    if (options.basePages) {
+        modes.push_back(Exs_LatencyPageMode::BasePages);
+    }
+
+    std::vector<uint64> sizes = Exs_GetLatencySizes(options, Exs_GetLatencyMaxBytes(options));
+
+    // A helper thread keeps the caller's affinity untouched
+    std::thread worker([&]() {
+        Platform::Exs_PinCurrentThreadToCPU(cpu);
+        for (uint32 memoryNode : memoryNodes) {
+            for (Exs_LatencyPageMode mode : modes) {
+                Exs_LatencyCurve curve = {};
+                curve.cpuNode = cpuNode;
+                curve.memoryNode = memoryNode;
+                curve.cpu = cpu;
+                curve.pageMode = mode;
+                if (Exs_MeasureLatencyCurve(curve, sizes, options)) {
+                    report.curves.push_back(curve);
+                }
+            }
+        }
+    });
+    worker.join();
+
+    return report;
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
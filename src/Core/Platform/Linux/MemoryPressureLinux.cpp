@@ -0,0 +1,267 @@
+// src/Core/Platform/Linux/MemoryPressureLinux.cpp
+#include "../internal/MemoryPressure.h"
+#include "SysfsLinux.h"
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_ReadSysfsFile;
+
+constexpr const char* kExs_SystemPressurePath = "/proc/pressure/memory";
+
+// Parses one "some avg10=0.12 avg60=0.05 avg300=0.01 total=12345" line
+static bool Exs_ParsePressureLine(const char* line, Exs_PressureStall& stall) {
+    const char* avg10 = strstr(line, "avg10=");
+    const char* avg60 = strstr(line, "avg60=");
+    const char* avg300 = strstr(line, "avg300=");
+    const char* total = strstr(line, "total=");
+    if (!avg10 || !avg60 || !avg300 || !total) {
+        return false;
+    }
+
+    stall.avg10 = strtod(avg10 + 6, nullptr);
+    stall.avg60 = strtod(avg60 + 6, nullptr);
+    stall.avg300 = strtod(avg300 + 7, nullptr);
+    stall.totalMicroseconds = strtoull(total + 6, nullptr, 10);
+    return true;
+}
+
+bool Exs_ParseMemoryPressure(const char* text, Exs_MemoryPressure& pressure) {
+    pressure = {};
+
+    // "full" is missing on kernels that only track it for memory and io
+    bool haveSome = false;
+    for (const char* line = text; line && *line;) {
+        const char* next = strchr(line, '\n');
+        std::string current = next ? std::string(line, next - line) : std::string(line);
+        if (current.compare(0, 5, "some ") == 0) {
+            haveSome = Exs_ParsePressureLine(current.c_str(), pressure.some);
+        } else if (current.compare(0, 5, "full ") == 0) {
+            Exs_ParsePressureLine(current.c_str(), pressure.full);
+        }
+        line = next ? next + 1 : nullptr;
+    }
+    return haveSome;
+}
+
+static bool Exs_ReadPressureFile(const char* path, Exs_MemoryPressure& pressure) {
+    char buffer[256];
+    if (Exs_ReadSysfsFile(path, buffer, sizeof(buffer)) <= 0) {
+        pressure = {};
+        return false;
+    }
+    return Exs_ParseMemoryPressure(buffer, pressure);
+}
+
+static std::string Exs_BuildCgroupMemoryPressurePath() {
+    // Format: "0::/user.slice/app.scope", the cgroup v2 entry
+    std::string group;
+    if (FILE* file = fopen("/proc/self/cgroup", "r")) {
+        char line[4096];
+        while (fgets(line, sizeof(line), file)) {
+            if (strncmp(line, "0::", 3) == 0) {
+                group = line + 3;
+                while (!group.empty() && (group.back() == '\n' || group.back() == ' ')) {
+                    group.pop_back();
+                }
+                break;
+            }
+        }
+        fclose(file);
+    }
+    if (group.empty()) {
+        return std::string();
+    }
+
+    // Format: "id parent major:minor root mountpoint options - cgroup2 source options"
+    std::string mountPoint;
+    if (FILE* file = fopen("/proc/self/mountinfo", "r")) {
+        char line[4096];
+        while (fgets(line, sizeof(line), file)) {
+            if (!strstr(line, " - cgroup2 ")) {
+                continue;
+            }
+            char root[1024];
+            char mount[1024];
+            if (sscanf(line, "%*u %*u %*s %1023s %1023s", root, mount) == 2) {
+                mountPoint = mount;
+                // A namespaced mount shows the group relative to its root
+                if (strcmp(root, "/") != 0 && group.compare(0, strlen(root), root) == 0) {
+                    group.erase(0, strlen(root));
+                }
+                break;
+            }
+        }
+        fclose(file);
+    }
+    if (mountPoint.empty()) {
+        return std::string();
+    }
+
+    if (group == "/") {
+        group.clear();
+    }
+    std::string path = mountPoint + group + "/memory.pressure";
+    return access(path.c_str(), R_OK) == 0 ? path : std::string();
+}
+
+std::string Exs_GetCgroupMemoryPressurePath() {
+    static const std::string path = Exs_BuildCgroupMemoryPressurePath();
+    return path;
+}
+
+bool Exs_ReadMemoryPressure(Exs_PressureSource source, Exs_MemoryPressure& pressure) {
+    if (source == Exs_PressureSource::System) {
+        return Exs_ReadPressureFile(kExs_SystemPressurePath, pressure);
+    }
+
+    std::string path = Exs_GetCgroupMemoryPressurePath();
+    if (path.empty()) {
+        pressure = {};
+        return false;
+    }
+    return Exs_ReadPressureFile(path.c_str(), pressure);
+}
+
+Exs_MemoryPressureMonitor::Exs_MemoryPressureMonitor()
+    : wakeFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) {
+}
+
+Exs_MemoryPressureMonitor::~Exs_MemoryPressureMonitor() {
+    stop();
+    for (const Trigger& trigger : triggers) {
+        close(trigger.fd);
+    }
+    if (wakeFd >= 0) {
+        close(wakeFd);
+    }
+}
+
+int32 Exs_MemoryPressureMonitor::addTrigger(const Exs_PressureTrigger& trigger) {
+    std::string path = trigger.source == Exs_PressureSource::System ? std::string(kExs_SystemPressurePath)
+                                                                   : Exs_GetCgroupMemoryPressurePath();
+    if (path.empty()) {
+        return -1;
+    }
+
+    int fd = open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    // The kernel parses "<some|full> <stall us> <window us>" including the NUL
+    char request[64];
+    int length = snprintf(request, sizeof(request), "%s %u %u",
+                          trigger.kind == Exs_PressureKind::Full ? "full" : "some",
+                          trigger.stallMicroseconds, trigger.windowMicroseconds);
+    if (write(fd, request, static_cast<size_t>(length) + 1) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    int32 id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        id = static_cast<int32>(triggers.size());
+        triggers.push_back({ fd, false });
+    }
+
+    // A waiter already in poll() picks the new descriptor up
+    if (waiting) {
+        wake();
+    }
+    return id;
+}
+
+void Exs_MemoryPressureMonitor::wake() {
+    if (wakeFd >= 0) {
+        uint64 one = 1;
+        ssize_t ignored = write(wakeFd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+std::vector<int32> Exs_MemoryPressureMonitor::wait(int32 timeoutMs) {
+    std::vector<int32> fired;
+
+    // Set before the snapshot so a trigger added meanwhile still wakes us
+    waiting = true;
+
+    std::vector<pollfd> fds;
+    std::vector<int32> ids;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < triggers.size(); i++) {
+            if (!triggers[i].failed) {
+                fds.push_back({ triggers[i].fd, POLLPRI, 0 });
+                ids.push_back(static_cast<int32>(i));
+            }
+        }
+    }
+    if (wakeFd >= 0) {
+        fds.push_back({ wakeFd, POLLIN, 0 });
+    }
+    if (fds.empty()) {
+        waiting = false;
+        return fired;
+    }
+
+    int ready = poll(fds.data(), fds.size(), timeoutMs);
+    waiting = false;
+    if (ready <= 0) {
+        return fired;
+    }
+
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (fds[i].revents & POLLERR) {
+            std::lock_guard<std::mutex> lock(mutex);
+            triggers[ids[i]].failed = true;
+        } else if (fds[i].revents & POLLPRI) {
+            fired.push_back(ids[i]);
+        }
+    }
+
+    if (wakeFd >= 0 && (fds.back().revents & POLLIN)) {
+        uint64 count;
+        ssize_t ignored = read(wakeFd, &count, sizeof(count));
+        (void)ignored;
+    }
+    return fired;
+}
+
+bool Exs_MemoryPressureMonitor::start(Exs_PressureCallback callback) {
+    if (thread.joinable() || wakeFd < 0) {
+        return false;
+    }
+
+    stopping = false;
+    thread = std::thread([this, callback = std::move(callback)]() {
+        while (!stopping) {
+            for (int32 trigger : wait(-1)) {
+                callback(trigger);
+            }
+        }
+    });
+    return true;
+}
+
+void Exs_MemoryPressureMonitor::stop() {
+    if (!thread.joinable()) {
+        return;
+    }
+    stopping = true;
+    wake();
+    thread.join();
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
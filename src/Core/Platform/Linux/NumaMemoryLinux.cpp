@@ -0,0 +1,264 @@
+// src/Core/Platform/Linux/NumaMemoryLinux.cpp
+#include "../internal/NumaMemory.h"
+#include "../internal/ThreadPool.h"
+#include "SysfsLinux.h"
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+#include <thread>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+using Platform::Exs_ReadSysfsFile;
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ParseCPUList;
+using Platform::Exs_GetBasePageSize;
+
+constexpr uint32 kExs_NumaMaxNodes = 1024;
+constexpr uint64 kExs_MovePagesBatch = 1024;
+
+static std::vector<uint32> Exs_ReadNodeList(const char* path) {
+    std::vector<uint32> nodes = Exs_ParseCPUList(Exs_ReadSysfsString(path).c_str());
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+    return nodes;
+}
+
+static std::string Exs_GetNodePath(uint32 node, const char* file) {
+    return "/sys/devices/system/node/node" + std::to_string(node) + "/" + file;
+}
+
+bool Exs_GetNumaNodeInfo(uint32 node, Exs_NumaNodeInfo& info) {
+    info = {};
+    info.node = node;
+
+    char buffer[4096];
+    int64 size = Exs_ReadSysfsFile(Exs_GetNodePath(node, "meminfo").c_str(), buffer, sizeof(buffer));
+    if (size <= 0 || !Exs_ParseMemInfo(buffer, static_cast<size_t>(size), info.values)) {
+        return false;
+    }
+
+    info.totalBytes = info.values.get(Exs_MemInfoField::MemTotal);
+    info.freeBytes = info.values.get(Exs_MemInfoField::MemFree);
+    info.usedBytes = info.values.has(Exs_MemInfoField::MemUsed) ? info.values.get(Exs_MemInfoField::MemUsed)
+                                                                 : info.totalBytes - info.freeBytes;
+    info.anonBytes = info.values.get(Exs_MemInfoField::AnonPages);
+    info.hugePagesTotal = info.values.get(Exs_MemInfoField::HugePages_Total);
+    info.hugePagesFree = info.values.get(Exs_MemInfoField::HugePages_Free);
+    info.cpus = Exs_ParseCPUList(Exs_ReadSysfsString(Exs_GetNodePath(node, "cpulist")).c_str());
+
+    // Format: "10 21", one distance per online node
+    std::string distances = Exs_ReadSysfsString(Exs_GetNodePath(node, "distance"));
+    const char* cursor = distances.c_str();
+    char* end = nullptr;
+    for (unsigned long value = strtoul(cursor, &end, 10); end != cursor; value = strtoul(cursor, &end, 10)) {
+        info.distances.push_back(static_cast<uint32>(value));
+        cursor = end;
+    }
+    return true;
+}
+
+std::vector<Exs_NumaNodeInfo> Exs_GetNumaNodes() {
+    std::vector<Exs_NumaNodeInfo> nodes;
+    for (uint32 node : Exs_ReadNodeList("/sys/devices/system/node/online")) {
+        Exs_NumaNodeInfo info;
+        if (Exs_GetNumaNodeInfo(node, info)) {
+            nodes.push_back(info);
+        }
+    }
+    return nodes;
+}
+
+uint32 Exs_GetNumaNodeOfCPU(uint32 cpu) {
+    // The cpuN directory holds a nodeM link for its node
+    std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/node";
+    for (uint32 node : Exs_ReadNodeList("/sys/devices/system/node/online")) {
+        if (access((base + std::to_string(node)).c_str(), F_OK) == 0) {
+            return node;
+        }
+    }
+    return 0;
+}
+
+std::vector<uint32> Exs_GetNumaMemoryNodes() {
+    return Exs_ReadNodeList("/sys/devices/system/node/has_memory");
+}
+
+// Kernel mode and node mask for a policy; false if a node is out of range
+static bool Exs_BuildNumaMask(Exs_NumaPolicy policy, const std::vector<uint32>& nodes,
+                              int& mode, unsigned long* mask, bool& useMask) {
+    switch (policy) {
+        case Exs_NumaPolicy::Default:    mode = MPOL_DEFAULT; break;
+        case Exs_NumaPolicy::Bind:       mode = MPOL_BIND; break;
+        case Exs_NumaPolicy::Preferred:  mode = MPOL_PREFERRED; break;
+        case Exs_NumaPolicy::Interleave: mode = MPOL_INTERLEAVE; break;
+        case Exs_NumaPolicy::Local:      mode = MPOL_LOCAL; break;
+    }
+
+    useMask = policy == Exs_NumaPolicy::Bind || policy == Exs_NumaPolicy::Preferred ||
+              policy == Exs_NumaPolicy::Interleave;
+    if (!useMask) {
+        return true;
+    }
+
+    std::vector<uint32> selected = nodes.empty() ? Exs_GetNumaMemoryNodes() : nodes;
+    if (policy == Exs_NumaPolicy::Preferred) {
+        selected.resize(1);
+    }
+
+    constexpr uint32 bitsPerWord = sizeof(unsigned long) * 8;
+    for (uint32 node : selected) {
+        if (node >= kExs_NumaMaxNodes) {
+            return false;
+        }
+        mask[node / bitsPerWord] |= 1UL << (node % bitsPerWord);
+    }
+    return true;
+}
+
+bool Exs_BindMemory(void* address, uint64 size, Exs_NumaPolicy policy,
+                    const std::vector<uint32>& nodes, bool movePages) {
+    int mode = MPOL_DEFAULT;
+    unsigned long mask[kExs_NumaMaxNodes / (sizeof(unsigned long) * 8)] = {};
+    bool useMask = false;
+    if (!Exs_BuildNumaMask(policy, nodes, mode, mask, useMask)) {
+        return false;
+    }
+
+    // maxnode counts one past the last bit the kernel reads
+    unsigned flags = movePages ? MPOL_MF_MOVE : 0;
+    return syscall(SYS_mbind, address, size, mode, useMask ? mask : nullptr,
+                   useMask ? kExs_NumaMaxNodes + 1 : 0, flags) == 0;
+}
+
+bool Exs_SetThreadNumaPolicy(Exs_NumaPolicy policy, const std::vector<uint32>& nodes) {
+    int mode = MPOL_DEFAULT;
+    unsigned long mask[kExs_NumaMaxNodes / (sizeof(unsigned long) * 8)] = {};
+    bool useMask = false;
+    if (!Exs_BuildNumaMask(policy, nodes, mode, mask, useMask)) {
+        return false;
+    }
+    return syscall(SYS_set_mempolicy, mode, useMask ? mask : nullptr, useMask ? kExs_NumaMaxNodes + 1 : 0) == 0;
+}
+
+static Exs_LargeRegion Exs_AllocateWithPolicy(uint64 size, Exs_NumaPolicy policy, const std::vector<uint32>& nodes,
+                                              uint64 preferredPageSize) {
+    Exs_LargeRegion region = Exs_AllocateLargeRegion(size, preferredPageSize);
+    if (region.backing != Exs_LargeRegionBacking::None &&
+        !Exs_BindMemory(region.address, region.size, policy, nodes)) {
+        Exs_FreeLargeRegion(region);
+    }
+    return region;
+}
+
+Exs_LargeRegion Exs_AllocateOnNode(uint64 size, uint32 node, uint64 preferredPageSize) {
+    return Exs_AllocateWithPolicy(size, Exs_NumaPolicy::Bind, { node }, preferredPageSize);
+}
+
+Exs_LargeRegion Exs_AllocateInterleaved(uint64 size, const std::vector<uint32>& nodes, uint64 preferredPageSize) {
+    return Exs_AllocateWithPolicy(size, Exs_NumaPolicy::Interleave, nodes, preferredPageSize);
+}
+
+double Exs_NumaPlacement::getNodeFraction(uint32 node) const {
+    uint64 resident = sampledPages - unmappedPages;
+    if (resident == 0 || node >= pagesPerNode.size()) {
+        return 0.0;
+    }
+    return static_cast<double>(pagesPerNode[node]) / static_cast<double>(resident);
+}
+
+Exs_NumaPlacement Exs_GetNumaPlacement(const void* address, uint64 size, uint64 pageSizeBytes) {
+    Exs_NumaPlacement placement = {};
+    placement.pageSizeBytes = pageSizeBytes != 0 ? pageSizeBytes : Exs_GetBasePageSize();
+
+    uintptr_t first = reinterpret_cast<uintptr_t>(address) / placement.pageSizeBytes * placement.pageSizeBytes;
+    uintptr_t last = reinterpret_cast<uintptr_t>(address) + size;
+
+    // With no target nodes move_pages() only reports where each page is
+    void* pages[kExs_MovePagesBatch];
+    int status[kExs_MovePagesBatch];
+    for (uintptr_t page = first; page < last;) {
+        uint64 count = 0;
+        for (; count < kExs_MovePagesBatch && page < last; count++, page += placement.pageSizeBytes) {
+            pages[count] = reinterpret_cast<void*>(page);
+        }
+        if (syscall(SYS_move_pages, 0, count, pages, nullptr, status, 0) != 0) {
+            break;
+        }
+
+        for (uint64 i = 0; i < count; i++) {
+            placement.sampledPages++;
+            if (status[i] < 0) {
+                placement.unmappedPages++;
+                continue;
+            }
+            uint32 node = static_cast<uint32>(status[i]);
+            if (node >= placement.pagesPerNode.size()) {
+                placement.pagesPerNode.resize(node + 1, 0);
+            }
+            placement.pagesPerNode[node]++;
+        }
+    }
+    return placement;
+}
+
+void Exs_FirstTouchPartitioned(void* address, uint64 size, const std::vector<uint32>& cpus, uint64 pageSizeBytes) {
+    if (cpus.empty() || size == 0) {
+        return;
+    }
+
+    // Slices are whole pages of the region's backing, so no huge page is
+    // split between two CPUs; a range smaller than the CPU list leaves the
+    // trailing CPUs without a slice
+    uint64 pageSize = pageSizeBytes != 0 ? pageSizeBytes : Exs_GetBasePageSize();
+    uintptr_t start = reinterpret_cast<uintptr_t>(address);
+    uintptr_t end = start + size;
+    uint64 firstPage = start / pageSize;
+    uint64 pageCount = (end - 1) / pageSize - firstPage + 1;
+    uint64 pagesPerSlice = (pageCount + cpus.size() - 1) / cpus.size();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < cpus.size() && i * pagesPerSlice < pageCount; i++) {
+        uint64 beginPage = firstPage + i * pagesPerSlice;
+        uint64 endPage = std::min(beginPage + pagesPerSlice, firstPage + pageCount);
+
+        threads.emplace_back([start, end, beginPage, endPage, pageSize, cpu = cpus[i]]() {
+            Platform::Exs_PinCurrentThreadToCPU(cpu);
+
+            // Rewriting the byte faults the page in without changing it
+            for (uint64 page = beginPage; page < endPage; page++) {
+                volatile char* byte = reinterpret_cast<volatile char*>(std::max<uintptr_t>(page * pageSize, start));
+                if (reinterpret_cast<uintptr_t>(byte) < end) {
+                    *byte = *byte;
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void Exs_FirstTouchForPool(void* address, uint64 size, const Platform::Exs_ThreadPool& pool, uint64 pageSizeBytes) {
+    std::vector<uint32> cpus;
+    for (uint32 worker = 0; worker < pool.getWorkerCount(); worker++) {
+        cpus.push_back(pool.getWorkerPlacement(worker).cpu);
+    }
+    Exs_FirstTouchPartitioned(address, size, cpus, pageSizeBytes);
+}
+
+void Exs_FirstTouchOnNode(void* address, uint64 size, uint32 node, uint64 pageSizeBytes) {
+    std::vector<uint32> cpus = Exs_ParseCPUList(Exs_ReadSysfsString(Exs_GetNodePath(node, "cpulist")).c_str());
+    Exs_FirstTouchPartitioned(address, size, cpus, pageSizeBytes);
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,407 @@
+// src/Core/Platform/Linux/PerfCountersLinux.cpp
+#include "../internal/PerfCounters.h"
+#include "../internal/ThreadRegistry.h"
+#include "SysfsLinux.h"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Open counters of one task or CPU; fds[i] is -1 for missing events
+struct Exs_PerfEventGroupHandle {
+    int fds[kExs_PerfCounterEventCount];
+    void* pages[kExs_PerfCounterEventCount];
+    int leaderFd;
+    uint32 memberCount;
+    uint32 memberEvents[kExs_PerfCounterEventCount]; // read order -> event index
+};
+
+static const uint64 s_perfEventConfigs[kExs_PerfCounterEventCount] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+static int Exs_PerfEventOpen(perf_event_attr* attr, pid_t pid, int cpu, int groupFd) {
+    return static_cast<int>(syscall(SYS_perf_event_open, attr, pid, cpu, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+static void Exs_ClosePerfEventGroup(Exs_PerfEventGroupHandle* group) {
+    size_t pageSize = static_cast<size_t>(Platform::Exs_GetBasePageSize());
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        if (group->pages[i] != nullptr) {
+            munmap(group->pages[i], pageSize);
+        }
+        if (group->fds[i] >= 0) {
+            close(group->fds[i]);
+        }
+    }
+    delete group;
+}
+
+// Opens the four events as one group on a task (pid, -1) or a CPU (-1, cpu)
+static Exs_PerfEventGroupHandle* Exs_OpenPerfEventGroup(pid_t pid, int cpu, bool mapPages) {
+    Exs_PerfEventGroupHandle* group = new Exs_PerfEventGroupHandle();
+    group->leaderFd = -1;
+    group->memberCount = 0;
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        group->fds[i] = -1;
+        group->pages[i] = nullptr;
+    }
+
+    // Kernel events need a lower perf_event_paranoid; retry user-only
+    for (int excludeKernel = 0; excludeKernel < 2 && group->leaderFd < 0; excludeKernel++) {
+        for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = s_perfEventConfigs[i];
+            attr.disabled = group->leaderFd < 0 ? 1 : 0;
+            attr.exclude_kernel = static_cast<uint64>(excludeKernel);
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            int fd = Exs_PerfEventOpen(&attr, pid, cpu, group->leaderFd);
+            if (fd < 0) {
+                if (group->leaderFd < 0 && (errno == EACCES || errno == EPERM) && excludeKernel == 0) {
+                    break;
+                }
+                continue;
+            }
+
+            if (group->leaderFd < 0) {
+                group->leaderFd = fd;
+            }
+            group->fds[i] = fd;
+            group->memberEvents[group->memberCount++] = i;
+        }
+    }
+
+    if (group->leaderFd < 0) {
+        Exs_ClosePerfEventGroup(group);
+        return nullptr;
+    }
+
+    if (mapPages) {
+        size_t pageSize = static_cast<size_t>(Platform::Exs_GetBasePageSize());
+        for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+            if (group->fds[i] < 0) {
+                continue;
+            }
+            void* page = mmap(nullptr, pageSize, PROT_READ, MAP_SHARED, group->fds[i], 0);
+            group->pages[i] = page == MAP_FAILED ? nullptr : page;
+        }
+    }
+
+    ioctl(group->leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group->leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return group;
+}
+
+// Multiplexing correction; nothing counted when the group never ran
+static uint64 Exs_ScaleCount(uint64 count, uint64 enabled, uint64 running) {
+    if (running == 0) {
+        return 0;
+    }
+    if (running >= enabled) {
+        return count;
+    }
+    return static_cast<uint64>(static_cast<double>(count) * static_cast<double>(enabled) /
+                               static_cast<double>(running));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static inline uint64 Exs_ReadPMC(uint32 counter) {
+    uint32 low = 0, high = 0;
+    __asm__ volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(counter));
+    return (static_cast<uint64>(high) << 32) | low;
+}
+
+static inline uint64 Exs_ReadTSC() {
+    uint32 low = 0, high = 0;
+    __asm__ volatile("rdtsc" : "=a"(low), "=d"(high));
+    return (static_cast<uint64>(high) << 32) | low;
+}
+
+// Self-monitoring read through the control page (see perf_event_mmap_page
+// in linux/perf_event.h). Fails when the event is not on the PMU right now
+// or the kernel did not grant user rdpmc and time.
+static bool Exs_ReadMappedCounter(const void* mapping, uint64& count, uint64& enabled, uint64& running) {
+    const volatile perf_event_mmap_page* page = static_cast<const volatile perf_event_mmap_page*>(mapping);
+
+    uint32 sequence = 0;
+    do {
+        sequence = page->lock;
+        __asm__ volatile("" ::: "memory");
+
+        if (!page->cap_user_rdpmc || !page->cap_user_time) {
+            return false;
+        }
+
+        uint32 index = page->index;
+        if (index == 0) {
+            return false;
+        }
+
+        enabled = page->time_enabled;
+        running = page->time_running;
+
+        // Extend both times to now
+        uint64 cycles = Exs_ReadTSC();
+        uint16 shift = page->time_shift;
+        uint32 multiplier = page->time_mult;
+        uint64 quotient = cycles >> shift;
+        uint64 remainder = cycles & ((static_cast<uint64>(1) << shift) - 1);
+        uint64 delta = page->time_offset + quotient * multiplier + ((remainder * multiplier) >> shift);
+        enabled += delta;
+        running += delta;
+
+        // Sign-extend the raw counter from its hardware width
+        uint16 width = page->pmc_width;
+        int64 pmc = static_cast<int64>(Exs_ReadPMC(index - 1));
+        pmc = static_cast<int64>(static_cast<uint64>(pmc) << (64 - width)) >> (64 - width);
+        count = static_cast<uint64>(page->offset + pmc);
+
+        __asm__ volatile("" ::: "memory");
+    } while (page->lock != sequence);
+
+    return true;
+}
+
+// Count only, for deltas taken on the owning thread
+static inline bool Exs_ReadMappedCount(const void* mapping, uint64& count) {
+    const volatile perf_event_mmap_page* page = static_cast<const volatile perf_event_mmap_page*>(mapping);
+
+    uint32 sequence = 0;
+    do {
+        sequence = page->lock;
+        __asm__ volatile("" ::: "memory");
+
+        uint32 index = page->index;
+        if (!page->cap_user_rdpmc || index == 0) {
+            return false;
+        }
+
+        uint16 width = page->pmc_width;
+        int64 pmc = static_cast<int64>(Exs_ReadPMC(index - 1));
+        pmc = static_cast<int64>(static_cast<uint64>(pmc) << (64 - width)) >> (64 - width);
+        count = static_cast<uint64>(page->offset + pmc);
+
+        __asm__ volatile("" ::: "memory");
+    } while (page->lock != sequence);
+
+    return true;
+}
+#endif
+
+// Adds one group's scaled counts to the sample
+static bool Exs_ReadPerfEventGroup(const Exs_PerfEventGroupHandle* group, bool useMappedPages,
+                                   Exs_PerfCounterSample& sample) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (useMappedPages) {
+        uint64 counts[kExs_PerfCounterEventCount] = {0};
+        uint64 enabled = 0, running = 0;
+        bool fast = true;
+        for (uint32 member = 0; member < group->memberCount && fast; member++) {
+            uint32 event = group->memberEvents[member];
+            fast = group->pages[event] != nullptr &&
+                   Exs_ReadMappedCounter(group->pages[event], counts[event], enabled, running);
+        }
+
+        if (fast) {
+            for (uint32 member = 0; member < group->memberCount; member++) {
+                uint32 event = group->memberEvents[member];
+                sample.values[event] += Exs_ScaleCount(counts[event], enabled, running);
+            }
+            sample.timeEnabledNs += enabled;
+            sample.timeRunningNs += running;
+            sample.multiplexed = sample.multiplexed || running < enabled;
+            return true;
+        }
+    }
+#else
+    (void)useMappedPages;
+#endif
+
+    // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr]
+    uint64 buffer[3 + kExs_PerfCounterEventCount] = {0};
+    ssize_t bytes = ::read(group->leaderFd, buffer, sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64))) {
+        return false;
+    }
+
+    uint64 memberCount = buffer[0];
+    uint64 enabled = buffer[1];
+    uint64 running = buffer[2];
+    for (uint64 member = 0; member < memberCount && member < group->memberCount; member++) {
+        uint32 event = group->memberEvents[member];
+        sample.values[event] += Exs_ScaleCount(buffer[3 + member], enabled, running);
+    }
+
+    sample.timeEnabledNs += enabled;
+    sample.timeRunningNs += running;
+    sample.multiplexed = sample.multiplexed || running < enabled;
+    return true;
+}
+
+double Exs_GetInstructionsPerCycle(const Exs_PerfCounterSample& sample) {
+    uint64 cycles = sample.get(Exs_PerfCounterEvent::Cycles);
+    if (cycles == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(sample.get(Exs_PerfCounterEvent::Instructions)) / static_cast<double>(cycles);
+}
+
+Exs_PerfCounterGroup::Exs_PerfCounterGroup(Exs_PerfCounterScope scope)
+    : scope(scope), ownerThreadId(Platform::Exs_GetOSThreadId()) {
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        available[i] = false;
+    }
+
+    switch (scope) {
+        case Exs_PerfCounterScope::Thread: {
+            // pid 0 / cpu -1 follows the calling thread across CPUs
+            Exs_PerfEventGroupHandle* group = Exs_OpenPerfEventGroup(0, -1, true);
+            if (group != nullptr) {
+                groups.push_back(group);
+            }
+            break;
+        }
+
+        case Exs_PerfCounterScope::Process: {
+            // inherit cannot be combined with PERF_FORMAT_GROUP, so every
+            // thread gets its own group; threads started later are not seen
+            DIR* dir = opendir("/proc/self/task");
+            if (dir == nullptr) {
+                break;
+            }
+            while (struct dirent* entry = readdir(dir)) {
+                if (entry->d_name[0] < '0' || entry->d_name[0] > '9') {
+                    continue;
+                }
+                pid_t tid = static_cast<pid_t>(atoi(entry->d_name));
+                Exs_PerfEventGroupHandle* group = Exs_OpenPerfEventGroup(tid, -1, false);
+                if (group != nullptr) {
+                    groups.push_back(group);
+                }
+            }
+            closedir(dir);
+            break;
+        }
+
+        case Exs_PerfCounterScope::System: {
+            for (uint32 cpu : Platform::Exs_GetOnlineCPUs()) {
+                Exs_PerfEventGroupHandle* group = Exs_OpenPerfEventGroup(-1, static_cast<int>(cpu), false);
+                if (group != nullptr) {
+                    groups.push_back(group);
+                }
+            }
+            break;
+        }
+    }
+
+    for (const Exs_PerfEventGroupHandle* group : groups) {
+        for (uint32 member = 0; member < group->memberCount; member++) {
+            available[group->memberEvents[member]] = true;
+        }
+    }
+}
+
+Exs_PerfCounterGroup::~Exs_PerfCounterGroup() {
+    for (Exs_PerfEventGroupHandle* group : groups) {
+        Exs_ClosePerfEventGroup(group);
+    }
+}
+
+bool Exs_PerfCounterGroup::isOpen() const {
+    return !groups.empty();
+}
+
+bool Exs_PerfCounterGroup::isEventAvailable(Exs_PerfCounterEvent event) const {
+    return available[static_cast<uint32>(event)];
+}
+
+bool Exs_PerfCounterGroup::hasFastRead() const {
+#if defined(__x86_64__) || defined(__i386__)
+    if (scope != Exs_PerfCounterScope::Thread || groups.empty()) {
+        return false;
+    }
+    const Exs_PerfEventGroupHandle* group = groups.front();
+    const volatile perf_event_mmap_page* page = static_cast<const volatile perf_event_mmap_page*>(
+        group->pages[group->memberEvents[0]]);
+    return page != nullptr && page->cap_user_rdpmc && page->cap_user_time;
+#else
+    return false;
+#endif
+}
+
+Exs_PerfCounterScope Exs_PerfCounterGroup::getScope() const {
+    return scope;
+}
+
+bool Exs_PerfCounterGroup::read(Exs_PerfCounterSample& sample) const {
+    memset(&sample, 0, sizeof(sample));
+
+    // rdpmc only sees the counters of the thread it runs on
+    bool useMappedPages = scope == Exs_PerfCounterScope::Thread &&
+                          Platform::Exs_GetOSThreadId() == ownerThreadId;
+
+    bool anyRead = false;
+    for (const Exs_PerfEventGroupHandle* group : groups) {
+        anyRead = Exs_ReadPerfEventGroup(group, useMappedPages, sample) || anyRead;
+    }
+    return anyRead;
+}
+
+bool Exs_PerfCounterGroup::readUnscaled(uint64 values[kExs_PerfCounterEventCount]) const {
+    for (uint32 i = 0; i < kExs_PerfCounterEventCount; i++) {
+        values[i] = 0;
+    }
+    if (groups.empty()) {
+        return false;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (scope == Exs_PerfCounterScope::Thread && groups.size() == 1) {
+        const Exs_PerfEventGroupHandle* group = groups.front();
+        bool fast = true;
+        for (uint32 member = 0; member < group->memberCount && fast; member++) {
+            uint32 event = group->memberEvents[member];
+            fast = group->pages[event] != nullptr && Exs_ReadMappedCount(group->pages[event], values[event]);
+        }
+        if (fast) {
+            return true;
+        }
+    }
+#endif
+
+    bool anyRead = false;
+    for (const Exs_PerfEventGroupHandle* group : groups) {
+        uint64 buffer[3 + kExs_PerfCounterEventCount] = {0};
+        ssize_t bytes = ::read(group->leaderFd, buffer, sizeof(buffer));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(uint64))) {
+            continue;
+        }
+        for (uint64 member = 0; member < buffer[0] && member < group->memberCount; member++) {
+            values[group->memberEvents[member]] += buffer[3 + member];
+        }
+        anyRead = true;
+    }
+    return anyRead;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,399 @@
+// src/Core/Platform/Linux/PlatformLinux.cpp
+#include "../internal/PlatformBase.h"
+#include "../internal/PlatformDescriptor.h"
+#include "../internal/ProcessLauncher.h"
+#include "../internal/ThreadRegistry.h"
+#include "../internal/CPUFeatureSet.h"
+#include "SysfsLinux.h"
+#include <unistd.h>
+#include <pwd.h>
+#include <time.h>
+#include <sys/utsname.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <fstream>
+#include <set>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Time source backing the high resolution timer
+enum class Exs_TimerSource {
+    Monotonic = 0,
+    TSC = 1,
+    ArmGenericTimer = 2
+};
+
+struct Exs_TimerCalibration {
+    Exs_TimerSource source;
+    double frequency;
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+static bool Exs_HasInvariantTSC() {
+    // TSC runs at a constant rate across P-, C- and T-states
+    if (!CPUInfo::Exs_GetCPUFeatureSet().has(CPUInfo::Exs_CPUFeature::INVARIANT_TSC)) {
+        return false;
+    }
+
+    // The kernel demotes the TSC when it detects cross-socket skew or
+    // instability; honour that verdict when it is visible to us
+    std::string clocksource = Exs_ReadSysfsString(
+        "/sys/devices/system/clocksource/clocksource0/current_clocksource");
+    return clocksource.empty() || clocksource == "tsc";
+}
+
+static inline uint64 Exs_ReadTSC() {
+    return __rdtsc();
+}
+#endif
+
+#if defined(__aarch64__)
+static inline uint64 Exs_ReadArmCounter() {
+    uint64 value;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+
+static inline uint64 Exs_ReadArmCounterFrequency() {
+    uint64 value;
+    __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(value));
+    return value;
+}
+#endif
+
+static Exs_TimerCalibration Exs_CalibrateTimer() {
+    Exs_TimerCalibration calibration = { Exs_TimerSource::Monotonic, 1000000000.0 };
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (Exs_HasInvariantTSC()) {
+        // Measure TSC ticks against CLOCK_MONOTONIC over a short window,
+        // bracketing each TSC read to keep the sampling error small
+        uint64 startNs = Exs_GetMonotonicNanoseconds();
+        uint64 startTsc = Exs_ReadTSC();
+
+        struct timespec window = { 0, 10000000 }; // 10ms
+        nanosleep(&window, nullptr);
+
+        uint64 endNs = Exs_GetMonotonicNanoseconds();
+        uint64 endTsc = Exs_ReadTSC();
+
+        if (endNs > startNs && endTsc > startTsc) {
+            calibration.source = Exs_TimerSource::TSC;
+            calibration.frequency = static_cast<double>(endTsc - startTsc) * 1e9 /
+                                    static_cast<double>(endNs - startNs);
+        }
+    }
+#elif defined(__aarch64__)
+    uint64 counterFrequency = Exs_ReadArmCounterFrequency();
+    if (counterFrequency != 0) {
+        calibration.source = Exs_TimerSource::ArmGenericTimer;
+        calibration.frequency = static_cast<double>(counterFrequency);
+    }
+#endif
+
+    return calibration;
+}
+
+// Calibrated once per process, read-only afterwards
+static const Exs_TimerCalibration& Exs_GetTimerCalibration() {
+    static const Exs_TimerCalibration calibration = Exs_CalibrateTimer();
+    return calibration;
+}
+
+static uint32 Exs_CountPhysicalCores(uint32 logicalCount) {
+    // A physical core is a unique (package, core) pair in sysfs topology
+    std::set<std::pair<int32, int32>> cores;
+
+    for (uint32 cpu = 0; cpu < logicalCount; cpu++) {
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        std::string package = Exs_ReadSysfsString(base + "physical_package_id");
+        std::string core = Exs_ReadSysfsString(base + "core_id");
+        if (package.empty() || core.empty()) {
+            continue;
+        }
+        cores.insert({ std::atoi(package.c_str()), std::atoi(core.c_str()) });
+    }
+
+    return cores.empty() ? logicalCount : static_cast<uint32>(cores.size());
+}
+
+static uint32 Exs_DetectCacheLineSize() {
+    long lineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    if (lineSize > 0) {
+        return static_cast<uint32>(lineSize);
+    }
+
+    std::string sysfsLine = Exs_ReadSysfsString(
+        "/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size");
+    if (!sysfsLine.empty() && std::atoi(sysfsLine.c_str()) > 0) {
+        return static_cast<uint32>(std::atoi(sysfsLine.c_str()));
+    }
+    return 64;
+}
+
+// Same bitmap CPUInfo reports, so both agree on OS-enabled register state
+static void Exs_DetectSIMD(Exs_PlatformDescriptor& descriptor) {
+    using CPUInfo::Exs_CPUFeature;
+    const CPUInfo::Exs_CPUFeatureSet& features = CPUInfo::Exs_GetCPUFeatureSet();
+
+    descriptor.hasSSE = features.has(Exs_CPUFeature::SSE);
+    descriptor.hasSSE2 = features.has(Exs_CPUFeature::SSE2);
+    descriptor.hasSSE42 = features.has(Exs_CPUFeature::SSE4_2);
+    descriptor.hasAVX = features.has(Exs_CPUFeature::AVX);
+    descriptor.hasAVX2 = features.has(Exs_CPUFeature::AVX2);
+    descriptor.hasAVX512F = features.has(Exs_CPUFeature::AVX512F);
+    descriptor.hasNEON = features.has(Exs_CPUFeature::ASIMD);
+}
+
+static Exs_PlatformDescriptor Exs_BuildPlatformDescriptor() {
+    Exs_PlatformDescriptor descriptor = {};
+    descriptor.architecture = Exs_CompileTimeArchitecture();
+    descriptor.endianness = Exs_CompileTimeEndianness();
+
+    descriptor.pageSize = static_cast<uint32>(Exs_GetBasePageSize());
+    descriptor.cacheLineSize = Exs_DetectCacheLineSize();
+
+    long logicalCount = sysconf(_SC_NPROCESSORS_ONLN);
+    descriptor.logicalCoreCount = logicalCount > 0 ? static_cast<uint32>(logicalCount) : 1;
+    descriptor.physicalCoreCount = Exs_CountPhysicalCores(descriptor.logicalCoreCount);
+
+    Exs_DetectSIMD(descriptor);
+    return descriptor;
+}
+
+const Exs_PlatformDescriptor& Exs_GetPlatformDescriptor() {
+    static const Exs_PlatformDescriptor descriptor = Exs_BuildPlatformDescriptor();
+    return descriptor;
+}
+
+// Build the descriptor at load time so the first hot-path reader never pays for it
+static const Exs_PlatformDescriptor& s_loadTimeDescriptor = Exs_GetPlatformDescriptor();
+
+class Exs_PlatformLinux : public Exs_PlatformBase {
+private:
+    std::string platformName;
+    std::string platformVersion;
+    std::string platformVendor;
+    Exs_TimerSource timerSource;
+    double timerFrequency;
+
+public:
+    Exs_PlatformLinux() {
+        const Exs_TimerCalibration& calibration = Exs_GetTimerCalibration();
+        timerSource = calibration.source;
+        timerFrequency = calibration.frequency;
+
+        detectPlatform();
+    }
+
+    virtual ~Exs_PlatformLinux() = default;
+
+    Exs_PlatformType getPlatformType() const override {
+#if defined(__ANDROID__)
+        return Exs_PlatformType::Android;
+#else
+        return Exs_PlatformType::Linux;
+#endif
+    }
+
+    Exs_Architecture getArchitecture() const override {
+        return Exs_GetPlatformDescriptor().architecture;
+    }
+
+    Exs_Endianness getEndianness() const override {
+        return Exs_GetPlatformDescriptor().endianness;
+    }
+
+    std::string getPlatformName() const override {
+        return platformName;
+    }
+
+    std::string getPlatformVersion() const override {
+        return platformVersion;
+    }
+
+    std::string getPlatformVendor() const override {
+        return platformVendor;
+    }
+
+    bool isMobilePlatform() const override {
+        return getPlatformType() == Exs_PlatformType::Android;
+    }
+
+    bool isDesktopPlatform() const override {
+        return !isMobilePlatform();
+    }
+
+    bool isConsolePlatform() const override {
+        return false;
+    }
+
+    bool supportsSIMD() const override {
+        const Exs_PlatformDescriptor& descriptor = Exs_GetPlatformDescriptor();
+        return descriptor.hasSSE || descriptor.hasNEON;
+    }
+
+    bool supportsAVX() const override {
+        return Exs_GetPlatformDescriptor().hasAVX;
+    }
+
+    bool supportsNEON() const override {
+        return Exs_GetPlatformDescriptor().hasNEON;
+    }
+
+    std::string getHomeDirectory() const override {
+        const char* home = getenv("HOME");
+        if (home != nullptr && home[0] != '\0') {
+            return home;
+        }
+
+        struct passwd* pw = getpwuid(getuid());
+        if (pw != nullptr && pw->pw_dir != nullptr) {
+            return pw->pw_dir;
+        }
+        return "";
+    }
+
+    std::string getTempDirectory() const override {
+        const char* tmpdir = getenv("TMPDIR");
+        if (tmpdir != nullptr && tmpdir[0] != '\0') {
+            return tmpdir;
+        }
+        return "/tmp";
+    }
+
+    std::string getAppDataDirectory() const override {
+        const char* configHome = getenv("XDG_CONFIG_HOME");
+        if (configHome != nullptr && configHome[0] != '\0') {
+            return configHome;
+        }
+
+        std::string home = getHomeDirectory();
+        if (!home.empty()) {
+            return home + "/.config";
+        }
+        return "";
+    }
+
+    std::string getExecutableDirectory() const override {
+        char path[4096];
+        ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+        if (len > 0) {
+            std::string exePath(path, static_cast<size_t>(len));
+            size_t pos = exePath.find_last_of('/');
+            if (pos != std::string::npos) {
+                exePath = exePath.substr(0, pos);
+            }
+            return exePath;
+        }
+        return "";
+    }
+
+    void executeCommand(const std::string& command) const override {
+        executeCommandWithResult(command);
+    }
+
+    int32 executeCommandWithResult(const std::string& command) const override {
+        // Like system(), the command's output goes to our own stdout/stderr
+        Exs_ProcessOptions options;
+        options.arguments = { "/bin/sh", "-c", command };
+        options.onStdout = [](const char* data, size_t size) {
+            ssize_t written = write(STDOUT_FILENO, data, size);
+            (void)written;
+        };
+        options.onStderr = [](const char* data, size_t size) {
+            ssize_t written = write(STDERR_FILENO, data, size);
+            (void)written;
+        };
+        return Exs_RunProcess(options).waitStatus;
+    }
+
+    uint32 getCurrentThreadId() const override {
+        return Exs_GetOSThreadId();
+    }
+
+    uint32 getCurrentProcessId() const override {
+        return static_cast<uint32>(getpid());
+    }
+
+    uint64 getHighResolutionTimer() const override {
+        switch (timerSource) {
+#if defined(__x86_64__) || defined(__i386__)
+            case Exs_TimerSource::TSC:
+                return Exs_ReadTSC();
+#endif
+#if defined(__aarch64__)
+            case Exs_TimerSource::ArmGenericTimer:
+                return Exs_ReadArmCounter();
+#endif
+            default:
+                return Exs_GetMonotonicNanoseconds();
+        }
+    }
+
+    double getHighResolutionTimerFrequency() const override {
+        return timerFrequency;
+    }
+
+    uint32 getMemoryPageSize() const override {
+        return Exs_GetPlatformDescriptor().pageSize;
+    }
+
+    uint32 getPhysicalCoreCount() const override {
+        return Exs_GetPlatformDescriptor().physicalCoreCount;
+    }
+
+    uint32 getLogicalCoreCount() const override {
+        return Exs_GetPlatformDescriptor().logicalCoreCount;
+    }
+
+private:
+    void detectPlatform() {
+        platformName = "Linux";
+        platformVendor = "Linux";
+
+        // Distribution name from os-release
+        std::ifstream osRelease("/etc/os-release");
+        std::string line;
+        while (std::getline(osRelease, line)) {
+            size_t eq = line.find('=');
+            if (eq == std::string::npos) {
+                continue;
+            }
+
+            std::string key = line.substr(0, eq);
+            std::string value = line.substr(eq + 1);
+            if (value.size() >= 2 && (value.front() == '"' || value.front() == '\'')) {
+                value = value.substr(1, value.size() - 2);
+            }
+
+            if (key == "PRETTY_NAME" && !value.empty()) {
+                platformName = value;
+            } else if (key == "NAME" && !value.empty()) {
+                platformVendor = value;
+            }
+        }
+
+        struct utsname uts;
+        if (uname(&uts) == 0) {
+            platformVersion = uts.release;
+        }
+    }
+};
+
+// Factory function implementation
+Exs_PlatformBase* Exs_CreatePlatformInstance() {
+    return new Exs_PlatformLinux();
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
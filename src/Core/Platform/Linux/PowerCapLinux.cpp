@@ -0,0 +1,421 @@
+// src/Core/Platform/Linux/PowerCapLinux.cpp
+#include "../internal/PowerCap.h"
+#include "SysfsLinux.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ListDirectory;
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+
+// RAPL MSRs (Intel SDM vol. 4, AMD PPR family 17h)
+constexpr uint64 kExs_MSR_RAPL_POWER_UNIT = 0x606;
+constexpr uint64 kExs_MSR_PKG_POWER_LIMIT = 0x610;
+constexpr uint64 kExs_MSR_PKG_ENERGY_STATUS = 0x611;
+constexpr uint64 kExs_MSR_DRAM_ENERGY_STATUS = 0x619;
+constexpr uint64 kExs_MSR_PP0_ENERGY_STATUS = 0x639;
+constexpr uint64 kExs_MSR_PP1_ENERGY_STATUS = 0x641;
+constexpr uint64 kExs_MSR_AMD_RAPL_POWER_UNIT = 0xC0010299;
+constexpr uint64 kExs_MSR_AMD_PKG_ENERGY_STATUS = 0xC001029B;
+
+struct Exs_PowerDomainState {
+    std::string name;
+    Exs_PowerDomainType type = Exs_PowerDomainType::Unknown;
+    uint32 packageId = 0;
+
+    // Energy counter: decimal text file, or an 8-byte MSR read at msrAddress
+    int fd = -1;
+    bool ownsFd = true;
+    bool isMSR = false;
+    uint64 msrAddress = 0;
+    uint64 range = 0;              // raw value at which the counter wraps, 0 = never
+    double microjoulesPerUnit = 1.0;
+
+    // Power limit, re-read on every sample
+    int limitFd = -1;
+    uint64 limitMSRAddress = 0;
+    double wattsPerLimitUnit = 0.0;
+    double limitWatts = 0.0;
+
+    uint64 lastRaw = 0;
+    bool haveRaw = false;
+    double accumulatedMicrojoules = 0.0;
+
+    Exs_EnergyHistory history;
+};
+
+static bool Exs_PreadUInt64Text(int fd, uint64& value) {
+    char buffer[32];
+    ssize_t bytes = pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (bytes <= 0) {
+        return false;
+    }
+    buffer[bytes] = '\0';
+    value = strtoull(buffer, nullptr, 10);
+    return true;
+}
+
+static bool Exs_PreadMSR(int fd, uint64 address, uint64& value) {
+    return pread(fd, &value, sizeof(value), static_cast<off_t>(address)) == static_cast<ssize_t>(sizeof(value));
+}
+
+static bool Exs_ReadDomainRaw(const Exs_PowerDomainState& domain, uint64& raw) {
+    if (domain.isMSR) {
+        if (!Exs_PreadMSR(domain.fd, domain.msrAddress, raw)) {
+            return false;
+        }
+        raw &= 0xFFFFFFFFULL;
+        return true;
+    }
+    return Exs_PreadUInt64Text(domain.fd, raw);
+}
+
+static void Exs_RefreshDomainLimit(Exs_PowerDomainState& domain) {
+    uint64 value = 0;
+    if (domain.limitFd >= 0 && domain.limitMSRAddress != 0) {
+        if (Exs_PreadMSR(domain.limitFd, domain.limitMSRAddress, value)) {
+            domain.limitWatts = static_cast<double>(value & 0x7FFF) * domain.wattsPerLimitUnit;
+        }
+    } else if (domain.limitFd >= 0 && Exs_PreadUInt64Text(domain.limitFd, value)) {
+        domain.limitWatts = static_cast<double>(value) * domain.wattsPerLimitUnit;
+    }
+}
+
+void Exs_EnergyHistory::add(uint64 timeNs, double energy, uint64 windowNs) {
+    timesNs.push_back(timeNs);
+    microjoules.push_back(energy);
+
+    // The second oldest sample still reaches the window edge
+    while (timesNs.size() > 2 && timeNs - timesNs[1] >= windowNs) {
+        timesNs.pop_front();
+        microjoules.pop_front();
+    }
+}
+
+double Exs_EnergyHistory::getWatts(uint64 windowNs) const {
+    if (timesNs.size() < 2) {
+        return 0.0;
+    }
+
+    size_t newest = timesNs.size() - 1;
+    size_t oldest = newest - 1;
+    while (oldest > 0 && timesNs[newest] - timesNs[oldest - 1] <= windowNs) {
+        oldest--;
+    }
+
+    uint64 elapsedNs = timesNs[newest] - timesNs[oldest];
+    if (elapsedNs == 0) {
+        return 0.0;
+    }
+
+    // uJ per ns is kW
+    return (microjoules[newest] - microjoules[oldest]) / static_cast<double>(elapsedNs) * 1000.0;
+}
+
+static Exs_PowerDomainType Exs_PowerDomainTypeFromName(const std::string& name) {
+    if (name.compare(0, 8, "package-") == 0) return Exs_PowerDomainType::Package;
+    if (name == "core") return Exs_PowerDomainType::Core;
+    if (name == "uncore") return Exs_PowerDomainType::Uncore;
+    if (name == "dram") return Exs_PowerDomainType::DRAM;
+    if (name == "psys") return Exs_PowerDomainType::Platform;
+    return Exs_PowerDomainType::Unknown;
+}
+
+Exs_PowerMonitor::Exs_PowerMonitor(uint64 windowMs)
+    : source(Exs_PowerSource::None), windowNs(windowMs * 1000000ULL), sampleCount(0), lastSampleNs(0) {
+    if (openPowercap()) {
+        source = Exs_PowerSource::Powercap;
+    } else if (openAMDEnergy()) {
+        source = Exs_PowerSource::AMDEnergy;
+    } else if (openMSR()) {
+        source = Exs_PowerSource::MSR;
+    }
+
+    for (Exs_PowerDomainState* domain : domains) {
+        Exs_RefreshDomainLimit(*domain);
+    }
+}
+
+Exs_PowerMonitor::~Exs_PowerMonitor() {
+    for (Exs_PowerDomainState* domain : domains) {
+        if (domain->ownsFd && domain->fd >= 0) {
+            close(domain->fd);
+        }
+        if (!domain->isMSR && domain->limitFd >= 0) {
+            close(domain->limitFd);
+        }
+        delete domain;
+    }
+}
+
+bool Exs_PowerMonitor::openPowercap() {
+    // Zones are listed flat: intel-rapl:P for packages/psys, intel-rapl:P:S for subdomains
+    const char* root = "/sys/class/powercap";
+    std::vector<std::pair<std::string, uint32>> zonePackages;
+
+    for (const std::string& zone : Exs_ListDirectory(root, "intel-rapl:")) {
+        std::string base = std::string(root) + "/" + zone + "/";
+        int fd = open((base + "energy_uj").c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            // energy_uj is root-only on kernels with the Platypus mitigation
+            continue;
+        }
+
+        Exs_PowerDomainState* domain = new Exs_PowerDomainState();
+        domain->name = Exs_ReadSysfsString(base + "name");
+        domain->type = Exs_PowerDomainTypeFromName(domain->name);
+        domain->fd = fd;
+
+        uint64 range = 0;
+        if (Exs_ReadSysfsUInt64(base + "max_energy_range_uj", range)) {
+            domain->range = range + 1;
+        }
+
+        domain->limitFd = open((base + "constraint_0_power_limit_uw").c_str(), O_RDONLY | O_CLOEXEC);
+        domain->wattsPerLimitUnit = 1e-6;
+
+        // Subzones inherit the package of their parent zone
+        std::string parent = zone.substr(0, zone.find(':', strlen("intel-rapl:")));
+        if (domain->type == Exs_PowerDomainType::Package) {
+            domain->packageId = static_cast<uint32>(atoi(domain->name.c_str() + 8));
+            zonePackages.push_back({ zone, domain->packageId });
+        } else {
+            for (const auto& pair : zonePackages) {
+                if (pair.first == parent) {
+                    domain->packageId = pair.second;
+                }
+            }
+        }
+
+        domains.push_back(domain);
+    }
+
+    return !domains.empty();
+}
+
+bool Exs_PowerMonitor::openAMDEnergy() {
+    const char* root = "/sys/class/hwmon";
+    for (const std::string& hwmon : Exs_ListDirectory(root, "hwmon")) {
+        std::string base = std::string(root) + "/" + hwmon + "/";
+        if (Exs_ReadSysfsString(base + "name") != "amd_energy") {
+            continue;
+        }
+
+        // energyN_label is "EsocketN" or "EcoreNNN"; counters are 64-bit microjoules
+        for (uint32 index = 1; index < 1024; index++) {
+            std::string label = Exs_ReadSysfsString(base + "energy" + std::to_string(index) + "_label");
+            if (label.empty()) {
+                break;
+            }
+
+            int fd = open((base + "energy" + std::to_string(index) + "_input").c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                continue;
+            }
+
+            Exs_PowerDomainState* domain = new Exs_PowerDomainState();
+            domain->name = label;
+            domain->fd = fd;
+            if (label.compare(0, 7, "Esocket") == 0) {
+                domain->type = Exs_PowerDomainType::Package;
+                domain->packageId = static_cast<uint32>(atoi(label.c_str() + 7));
+            } else {
+                // The driver does not tell which socket a core belongs to
+                domain->type = Exs_PowerDomainType::Core;
+            }
+            domains.push_back(domain);
+        }
+    }
+
+    return !domains.empty();
+}
+
+bool Exs_PowerMonitor::openMSR() {
+    // First online CPU of every package
+    std::vector<std::pair<uint32, uint32>> packageCPUs;
+    for (uint32 cpu : Platform::Exs_GetOnlineCPUs()) {
+        uint64 package = 0;
+        Exs_ReadSysfsUInt64("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                            "/topology/physical_package_id", package);
+        bool known = false;
+        for (const auto& pair : packageCPUs) {
+            known = known || pair.first == package;
+        }
+        if (!known) {
+            packageCPUs.push_back({ static_cast<uint32>(package), cpu });
+        }
+    }
+
+    for (const auto& pair : packageCPUs) {
+        std::string path = "/dev/cpu/" + std::to_string(pair.second) + "/msr";
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+
+        struct Exs_MSRDomain {
+            uint64 address;
+            Exs_PowerDomainType type;
+            const char* name;
+        };
+
+        uint64 units = 0;
+        bool amd = false;
+        std::vector<Exs_MSRDomain> candidates;
+        if (Exs_PreadMSR(fd, kExs_MSR_RAPL_POWER_UNIT, units)) {
+            candidates = {
+                { kExs_MSR_PKG_ENERGY_STATUS, Exs_PowerDomainType::Package, "package" },
+                { kExs_MSR_PP0_ENERGY_STATUS, Exs_PowerDomainType::Core, "core" },
+                { kExs_MSR_PP1_ENERGY_STATUS, Exs_PowerDomainType::Uncore, "uncore" },
+                { kExs_MSR_DRAM_ENERGY_STATUS, Exs_PowerDomainType::DRAM, "dram" }
+            };
+        } else if (Exs_PreadMSR(fd, kExs_MSR_AMD_RAPL_POWER_UNIT, units)) {
+            // Core energy on AMD is per core; only the package counter is read here
+            amd = true;
+            candidates = {
+                { kExs_MSR_AMD_PKG_ENERGY_STATUS, Exs_PowerDomainType::Package, "package" }
+            };
+        } else {
+            close(fd);
+            continue;
+        }
+
+        // Energy in units of 1/2^ESU J, power in units of 1/2^PU W
+        double microjoulesPerUnit = 1e6 / static_cast<double>(1ULL << ((units >> 8) & 0x1F));
+        double wattsPerUnit = 1.0 / static_cast<double>(1ULL << (units & 0xF));
+
+        bool ownsFd = true;
+        for (const Exs_MSRDomain& candidate : candidates) {
+            uint64 probe = 0;
+            if (!Exs_PreadMSR(fd, candidate.address, probe)) {
+                continue;
+            }
+
+            Exs_PowerDomainState* domain = new Exs_PowerDomainState();
+            domain->name = std::string(candidate.name) + "-" + std::to_string(pair.first);
+            domain->type = candidate.type;
+            domain->packageId = pair.first;
+            domain->fd = fd;
+            domain->ownsFd = ownsFd;
+            domain->isMSR = true;
+            domain->msrAddress = candidate.address;
+            domain->range = 1ULL << 32;
+            domain->microjoulesPerUnit = microjoulesPerUnit;
+            if (candidate.type == Exs_PowerDomainType::Package && !amd) {
+                domain->limitFd = fd;
+                domain->limitMSRAddress = kExs_MSR_PKG_POWER_LIMIT;
+                domain->wattsPerLimitUnit = wattsPerUnit;
+            }
+            domains.push_back(domain);
+            ownsFd = false;
+        }
+
+        if (ownsFd) {
+            close(fd);
+        }
+    }
+
+    return !domains.empty();
+}
+
+Exs_PowerSource Exs_PowerMonitor::getSource() const {
+    return source;
+}
+
+void Exs_PowerMonitor::setWindow(uint64 windowMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    windowNs = windowMs * 1000000ULL;
+}
+
+uint64 Exs_PowerMonitor::getWindow() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return windowNs / 1000000ULL;
+}
+
+bool Exs_PowerMonitor::sample(uint32 minIntervalMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (domains.empty()) {
+        return false;
+    }
+
+    if (sampleCount > 0 && Platform::Exs_KeepLastSample(lastSampleNs, minIntervalMs, sampleCount >= 2)) {
+        return true;
+    }
+    uint64 now = Platform::Exs_GetMonotonicNanoseconds();
+
+    for (Exs_PowerDomainState* domain : domains) {
+        uint64 raw = 0;
+        if (!Exs_ReadDomainRaw(*domain, raw)) {
+            continue;
+        }
+
+        if (domain->haveRaw) {
+            uint64 delta = Exs_EnergyCounterDelta(domain->lastRaw, raw, domain->range);
+            domain->accumulatedMicrojoules += static_cast<double>(delta) * domain->microjoulesPerUnit;
+        }
+        domain->lastRaw = raw;
+        domain->haveRaw = true;
+        domain->history.add(now, domain->accumulatedMicrojoules, windowNs);
+
+        Exs_RefreshDomainLimit(*domain);
+    }
+
+    sampleCount++;
+    lastSampleNs = now;
+    return true;
+}
+
+bool Exs_PowerMonitor::hasInterval() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return sampleCount >= 2;
+}
+
+std::vector<Exs_PowerDomainInfo> Exs_PowerMonitor::getDomains() const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::vector<Exs_PowerDomainInfo> infos;
+    infos.reserve(domains.size());
+    for (const Exs_PowerDomainState* domain : domains) {
+        Exs_PowerDomainInfo info;
+        info.name = domain->name;
+        info.type = domain->type;
+        info.packageId = domain->packageId;
+        info.powerWatts = domain->history.getWatts(windowNs);
+        info.powerLimitWatts = domain->limitWatts;
+        info.energyMicrojoules = static_cast<uint64>(domain->accumulatedMicrojoules);
+        infos.push_back(info);
+    }
+    return infos;
+}
+
+double Exs_PowerMonitor::getPackagePowerWatts() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    double watts = 0.0;
+    for (const Exs_PowerDomainState* domain : domains) {
+        if (domain->type == Exs_PowerDomainType::Package) {
+            watts += domain->history.getWatts(windowNs);
+        }
+    }
+    return watts;
+}
+
+double Exs_PowerMonitor::getPackagePowerLimitWatts() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    double watts = 0.0;
+    for (const Exs_PowerDomainState* domain : domains) {
+        if (domain->type == Exs_PowerDomainType::Package) {
+            watts += domain->limitWatts;
+        }
+    }
+    return watts;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
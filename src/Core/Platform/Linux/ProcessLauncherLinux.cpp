@@ -0,0 +1,285 @@
+// src/Core/Platform/Linux/ProcessLauncherLinux.cpp
+#include "../internal/ProcessLauncher.h"
+#include "SysfsLinux.h"
+#include <spawn.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+extern char** environ;
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// WNOHANG polling interval on kernels without pidfd_open
+constexpr int kExs_ProcessReapIntervalMs = 10;
+
+// Reads per stream after the child exited, so a writing grandchild cannot
+// keep us here
+constexpr uint32 kExs_ProcessDrainChunks = 64;
+
+static void Exs_ClosePipe(int fds[2]) {
+    for (int i = 0; i < 2; i++) {
+        if (fds[i] >= 0) {
+            close(fds[i]);
+            fds[i] = -1;
+        }
+    }
+}
+
+// Descriptor that becomes readable when pid exits, or -1 before Linux 5.3
+static int Exs_OpenProcessFd(pid_t pid) {
+#ifdef SYS_pidfd_open
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+    return -1;
+#endif
+}
+
+// Reaps pid if it has exited; blocking waits only after it was killed
+static bool Exs_ReapProcess(pid_t pid, bool block, Exs_ProcessResult& result) {
+    int status = 0;
+    struct rusage usage = {};
+    pid_t waited;
+    do {
+        waited = wait4(pid, &status, block ? 0 : WNOHANG, &usage);
+    } while (waited < 0 && errno == EINTR);
+
+    if (waited != pid) {
+        return false;
+    }
+
+    result.waitStatus = status;
+    if (WIFEXITED(status)) {
+        result.exited = true;
+        result.exitCode = WEXITSTATUS(status);
+    } else if (WIFSIGNALED(status)) {
+        result.termSignal = WTERMSIG(status);
+    }
+
+    result.userTimeUs = static_cast<uint64>(usage.ru_utime.tv_sec) * 1000000ULL +
+                        static_cast<uint64>(usage.ru_utime.tv_usec);
+    result.systemTimeUs = static_cast<uint64>(usage.ru_stime.tv_sec) * 1000000ULL +
+                          static_cast<uint64>(usage.ru_stime.tv_usec);
+    result.maxResidentKB = static_cast<uint64>(usage.ru_maxrss);
+    return true;
+}
+
+// Reads what is available on one stream; false once it is closed
+static bool Exs_ReadProcessStream(struct pollfd& stream, std::vector<char>& buffer,
+                                  const Exs_ProcessOutputCallback& callback) {
+    ssize_t bytesRead = read(stream.fd, buffer.data(), buffer.size());
+    if (bytesRead > 0) {
+        if (callback) {
+            callback(buffer.data(), static_cast<size_t>(bytesRead));
+        }
+        return true;
+    }
+    if (bytesRead < 0 && (errno == EINTR || errno == EAGAIN)) {
+        return true;
+    }
+
+    // EOF or hard error: stop polling this stream
+    close(stream.fd);
+    stream.fd = -1;
+    return false;
+}
+
+Exs_ProcessResult Exs_RunProcess(const Exs_ProcessOptions& options) {
+    Exs_ProcessResult result;
+    if (options.arguments.empty()) {
+        return result;
+    }
+
+    int stdoutPipe[2] = { -1, -1 };
+    int stderrPipe[2] = { -1, -1 };
+    if (pipe2(stdoutPipe, O_CLOEXEC) != 0 ||
+        (!options.inheritStderr && pipe2(stderrPipe, O_CLOEXEC) != 0)) {
+        Exs_ClosePipe(stdoutPipe);
+        Exs_ClosePipe(stderrPipe);
+        return result;
+    }
+
+    // Only our read ends are non-blocking; O_NONBLOCK is shared by both
+    // descriptors of an open file, so the write ends must not get it
+    fcntl(stdoutPipe[0], F_SETFL, O_NONBLOCK);
+    if (stderrPipe[0] >= 0) {
+        fcntl(stderrPipe[0], F_SETFL, O_NONBLOCK);
+    }
+
+    std::vector<char*> argv;
+    argv.reserve(options.arguments.size() + 1);
+    for (const auto& argument : options.arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    // Child gets the pipe write ends as stdout/stderr and /dev/null as stdin
+    // unless those are inherited; the dup2'd descriptors lose O_CLOEXEC,
+    // every other pipe end is closed on exec
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (!options.inheritStdin) {
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    }
+    posix_spawn_file_actions_adddup2(&actions, stdoutPipe[1], STDOUT_FILENO);
+    if (!options.inheritStderr) {
+        posix_spawn_file_actions_adddup2(&actions, stderrPipe[1], STDERR_FILENO);
+    }
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+    if (!options.workingDirectory.empty()) {
+        posix_spawn_file_actions_addchdir_np(&actions, options.workingDirectory.c_str());
+    }
+#endif
+
+    // Own process group so a timeout can take down the child's descendants too,
+    // with default signal dispositions and an empty mask
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    short flags = POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF;
+#ifdef POSIX_SPAWN_USEVFORK
+    flags |= POSIX_SPAWN_USEVFORK;
+#endif
+    posix_spawnattr_setflags(&attributes, flags);
+    posix_spawnattr_setpgroup(&attributes, 0);
+
+    sigset_t signalMask;
+    sigemptyset(&signalMask);
+    posix_spawnattr_setsigmask(&attributes, &signalMask);
+
+    sigset_t defaultSignals;
+    sigemptyset(&defaultSignals);
+    sigaddset(&defaultSignals, SIGPIPE);
+    sigaddset(&defaultSignals, SIGINT);
+    sigaddset(&defaultSignals, SIGQUIT);
+    sigaddset(&defaultSignals, SIGTERM);
+    posix_spawnattr_setsigdefault(&attributes, &defaultSignals);
+
+    uint64 startUs = Exs_GetMonotonicNanoseconds() / 1000;
+    pid_t pid = -1;
+    int spawnError = posix_spawnp(&pid, argv[0], &actions, &attributes, argv.data(), environ);
+
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attributes);
+
+    if (stdoutPipe[1] >= 0) {
+        close(stdoutPipe[1]);
+        stdoutPipe[1] = -1;
+    }
+    if (stderrPipe[1] >= 0) {
+        close(stderrPipe[1]);
+        stderrPipe[1] = -1;
+    }
+
+    if (spawnError != 0) {
+        Exs_ClosePipe(stdoutPipe);
+        Exs_ClosePipe(stderrPipe);
+        return result;
+    }
+    result.launched = true;
+
+    uint64 deadlineUs = options.timeoutMs > 0
+        ? startUs + static_cast<uint64>(options.timeoutMs) * 1000
+        : 0;
+
+    // Slot 2 wakes us when the child exits, so a child that closed or
+    // redirected its output is still reaped on time. Without a pidfd the
+    // loop checks with WNOHANG at a short interval instead.
+    int processFd = Exs_OpenProcessFd(pid);
+    std::vector<char> buffer(options.readChunkSize > 0 ? options.readChunkSize : 64 * 1024);
+    struct pollfd fds[3] = {
+        { stdoutPipe[0], POLLIN, 0 },
+        { stderrPipe[0], POLLIN, 0 },
+        { processFd, POLLIN, 0 }
+    };
+    const Exs_ProcessOutputCallback* callbacks[2] = { &options.onStdout, &options.onStderr };
+
+    bool reaped = false;
+    while (!reaped) {
+        int waitMs = processFd >= 0 ? -1 : kExs_ProcessReapIntervalMs;
+        if (deadlineUs != 0) {
+            uint64 nowUs = Exs_GetMonotonicNanoseconds() / 1000;
+            if (nowUs >= deadlineUs) {
+                result.timedOut = true;
+                break;
+            }
+            int remainingMs = static_cast<int>((deadlineUs - nowUs + 999) / 1000);
+            waitMs = waitMs < 0 ? remainingMs : std::min(waitMs, remainingMs);
+        }
+
+        int ready = poll(fds, 3, waitMs);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+
+        for (int i = 0; i < 2; i++) {
+            if (fds[i].fd >= 0 && fds[i].revents != 0) {
+                Exs_ReadProcessStream(fds[i], buffer, *callbacks[i]);
+            }
+        }
+
+        if (processFd < 0 || fds[2].revents != 0) {
+            reaped = Exs_ReapProcess(pid, false, result);
+        }
+    }
+
+    if (!reaped) {
+        // Deadline passed (or poll failed): take down the whole group
+        kill(-pid, SIGKILL);
+        Exs_ReapProcess(pid, true, result);
+    }
+
+    // The child is gone. Collect what it wrote before exiting, but do not
+    // wait for descendants that still hold the pipes open.
+    for (int i = 0; i < 2; i++) {
+        for (uint32 chunk = 0; chunk < kExs_ProcessDrainChunks && fds[i].fd >= 0; chunk++) {
+            int pending = 0;
+            if (!Exs_ReadProcessStream(fds[i], buffer, *callbacks[i]) ||
+                (ioctl(fds[i].fd, FIONREAD, &pending) == 0 && pending == 0)) {
+                break;
+            }
+        }
+        if (fds[i].fd >= 0) {
+            close(fds[i].fd);
+        }
+    }
+    if (processFd >= 0) {
+        close(processFd);
+    }
+
+    result.wallTimeUs = Exs_GetMonotonicNanoseconds() / 1000 - startUs;
+    return result;
+}
+
+Exs_ProcessResult Exs_RunShellCommand(const std::string& command, uint32 timeoutMs,
+                                      std::string* output) {
+    Exs_ProcessOptions options;
+    options.arguments = { "/bin/sh", "-c", command };
+    options.timeoutMs = timeoutMs;
+    options.inheritStdin = true;
+    options.inheritStderr = true;
+
+    if (output != nullptr) {
+        options.onStdout = [output](const char* data, size_t size) {
+            output->append(data, size);
+        };
+    }
+
+    return Exs_RunProcess(options);
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
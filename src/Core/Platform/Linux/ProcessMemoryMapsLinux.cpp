@@ -0,0 +1,264 @@
+// src/Core/Platform/Linux/ProcessMemoryMapsLinux.cpp
+#include "../internal/ProcessMemoryMaps.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// Holds a whole header line even with a PATH_MAX file name
+constexpr size_t kExs_MapsBufferSize = 16384;
+constexpr size_t kExs_MapsPathSize = 4096 + 64;
+
+struct Exs_MappingKey {
+    const char* name;
+    uint32 length;
+    uint64 Exs_MappingCounters::* field;
+};
+
+// smaps/smaps_rollup keys we keep; Hugetlb keys add into one field
+static const Exs_MappingKey kExs_MappingKeys[] = {
+    { "Rss", 3, &Exs_MappingCounters::rss },
+    { "Pss", 3, &Exs_MappingCounters::pss },
+    { "Pss_Anon", 8, &Exs_MappingCounters::pssAnon },
+    { "Pss_File", 8, &Exs_MappingCounters::pssFile },
+    { "Pss_Shmem", 9, &Exs_MappingCounters::pssShmem },
+    { "Shared_Clean", 12, &Exs_MappingCounters::sharedClean },
+    { "Shared_Dirty", 12, &Exs_MappingCounters::sharedDirty },
+    { "Private_Clean", 13, &Exs_MappingCounters::privateClean },
+    { "Private_Dirty", 13, &Exs_MappingCounters::privateDirty },
+    { "Referenced", 10, &Exs_MappingCounters::referenced },
+    { "Anonymous", 9, &Exs_MappingCounters::anonymous },
+    { "Swap", 4, &Exs_MappingCounters::swap },
+    { "SwapPss", 7, &Exs_MappingCounters::swapPss },
+    { "AnonHugePages", 13, &Exs_MappingCounters::anonHugePages },
+    { "Shared_Hugetlb", 14, &Exs_MappingCounters::hugetlb },
+    { "Private_Hugetlb", 15, &Exs_MappingCounters::hugetlb },
+    { "Locked", 6, &Exs_MappingCounters::locked },
+};
+
+// Parses "Rss:   1234 kB" into counters; false if the key is not kept
+static bool Exs_ParseMappingCounter(const char* line, const char* lineEnd, Exs_MappingCounters& counters,
+                                    uint64* kernelPageSize) {
+    const char* colon = static_cast<const char*>(memchr(line, ':', static_cast<size_t>(lineEnd - line)));
+    if (colon == nullptr) {
+        return false;
+    }
+    uint32 keyLength = static_cast<uint32>(colon - line);
+
+    uint64 valueKB = 0;
+    for (const char* cursor = colon + 1; cursor < lineEnd; cursor++) {
+        if (*cursor >= '0' && *cursor <= '9') {
+            valueKB = valueKB * 10 + static_cast<uint64>(*cursor - '0');
+        } else if (*cursor != ' ' && *cursor != '\t') {
+            break;
+        }
+    }
+
+    if (kernelPageSize != nullptr && keyLength == 14 && memcmp(line, "KernelPageSize", 14) == 0) {
+        *kernelPageSize = valueKB * 1024;
+        return true;
+    }
+
+    for (const Exs_MappingKey& key : kExs_MappingKeys) {
+        if (key.length == keyLength && memcmp(line, key.name, keyLength) == 0) {
+            counters.*key.field += valueKB * 1024;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint64 Exs_ParseHex(const char*& cursor, const char* end) {
+    uint64 value = 0;
+    for (; cursor < end; cursor++) {
+        char c = *cursor;
+        if (c >= '0' && c <= '9') {
+            value = (value << 4) | static_cast<uint64>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value = (value << 4) | static_cast<uint64>(c - 'a' + 10);
+        } else {
+            break;
+        }
+    }
+    return value;
+}
+
+static void Exs_SkipField(const char*& cursor, const char* end) {
+    while (cursor < end && *cursor != ' ') {
+        cursor++;
+    }
+    while (cursor < end && *cursor == ' ') {
+        cursor++;
+    }
+}
+
+// Parses "start-end perms offset dev inode   path"; the path is copied out
+// because the line's bytes are reused once the buffer refills
+static void Exs_ParseMappingHeader(const char* line, const char* end, Exs_MappingInfo& mapping, char* path) {
+    mapping = {};
+    mapping.path = path;
+
+    const char* cursor = line;
+    mapping.start = Exs_ParseHex(cursor, end);
+    if (cursor < end && *cursor == '-') {
+        cursor++;
+    }
+    mapping.end = Exs_ParseHex(cursor, end);
+    Exs_SkipField(cursor, end);
+
+    for (uint32 i = 0; i < 4 && cursor < end && *cursor != ' '; i++, cursor++) {
+        mapping.permissions[i] = *cursor;
+    }
+    Exs_SkipField(cursor, end);
+
+    mapping.offset = Exs_ParseHex(cursor, end);
+    Exs_SkipField(cursor, end);
+    Exs_SkipField(cursor, end); // dev
+
+    for (; cursor < end && *cursor >= '0' && *cursor <= '9'; cursor++) {
+        mapping.inode = mapping.inode * 10 + static_cast<uint64>(*cursor - '0');
+    }
+    while (cursor < end && *cursor == ' ') {
+        cursor++;
+    }
+
+    size_t pathLength = static_cast<size_t>(end - cursor);
+    if (pathLength >= kExs_MapsPathSize) {
+        pathLength = kExs_MapsPathSize - 1;
+    }
+    memcpy(path, cursor, pathLength);
+    path[pathLength] = '\0';
+}
+
+// Mapping headers start with a lowercase hex address, counters with a key
+static bool Exs_IsMappingHeader(const char* line, const char* end) {
+    return line < end && ((*line >= '0' && *line <= '9') || (*line >= 'a' && *line <= 'f'));
+}
+
+// Calls onLine for every line of path, read through a fixed buffer
+template <typename LineHandler>
+static bool Exs_StreamProcFile(const char* path, LineHandler&& onLine) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    char buffer[kExs_MapsBufferSize];
+    size_t filled = 0;
+    for (;;) {
+        ssize_t count = read(fd, buffer + filled, sizeof(buffer) - filled);
+        if (count < 0) {
+            close(fd);
+            return false;
+        }
+        filled += static_cast<size_t>(count);
+
+        char* line = buffer;
+        char* bufferEnd = buffer + filled;
+        while (line < bufferEnd) {
+            char* newline = static_cast<char*>(memchr(line, '\n', static_cast<size_t>(bufferEnd - line)));
+            if (newline == nullptr) {
+                break;
+            }
+            onLine(line, newline);
+            line = newline + 1;
+        }
+
+        // A line longer than the buffer is cut rather than dropped
+        if (line == buffer && filled == sizeof(buffer)) {
+            onLine(buffer, bufferEnd);
+            line = bufferEnd;
+        }
+
+        filled = static_cast<size_t>(bufferEnd - line);
+        memmove(buffer, line, filled);
+
+        if (count == 0) {
+            if (filled > 0) {
+                onLine(buffer, buffer + filled);
+            }
+            break;
+        }
+    }
+
+    close(fd);
+    return true;
+}
+
+static void Exs_FormatProcPath(char* path, size_t size, int32 pid, const char* file) {
+    if (pid == 0) {
+        snprintf(path, size, "/proc/self/%s", file);
+    } else {
+        snprintf(path, size, "/proc/%d/%s", pid, file);
+    }
+}
+
+bool Exs_ForEachMappingInFile(const char* filePath, Exs_MappingVisitFunction visit, void* context) {
+    Exs_MappingInfo mapping = {};
+    char path[kExs_MapsPathSize];
+    bool pending = false;
+
+    bool ok = Exs_StreamProcFile(filePath, [&](const char* line, const char* end) {
+        if (Exs_IsMappingHeader(line, end)) {
+            if (pending) {
+                visit(mapping, context);
+            }
+            Exs_ParseMappingHeader(line, end, mapping, path);
+            pending = true;
+        } else if (pending) {
+            Exs_ParseMappingCounter(line, end, mapping.counters, &mapping.kernelPageSizeBytes);
+        }
+    });
+
+    if (pending) {
+        visit(mapping, context);
+    }
+    return ok;
+}
+
+bool Exs_ForEachMapping(int32 pid, Exs_MappingDetail detail, Exs_MappingVisitFunction visit, void* context) {
+    char filePath[64];
+    Exs_FormatProcPath(filePath, sizeof(filePath), pid, detail == Exs_MappingDetail::Full ? "smaps" : "maps");
+    return Exs_ForEachMappingInFile(filePath, visit, context);
+}
+
+bool Exs_ReadMemoryRollup(int32 pid, Exs_MappingCounters& totals) {
+    totals = {};
+
+    char filePath[64];
+    Exs_FormatProcPath(filePath, sizeof(filePath), pid, "smaps_rollup");
+
+    // Format: one "[rollup]" header line, then the summed counters
+    bool ok = Exs_StreamProcFile(filePath, [&](const char* line, const char* end) {
+        Exs_ParseMappingCounter(line, end, totals, nullptr);
+    });
+    if (ok) {
+        return true;
+    }
+
+    return Exs_ForEachMapping(pid, Exs_MappingDetail::Full, [&totals](const Exs_MappingInfo& mapping) {
+        const Exs_MappingCounters& counters = mapping.counters;
+        totals.rss += counters.rss;
+        totals.pss += counters.pss;
+        totals.sharedClean += counters.sharedClean;
+        totals.sharedDirty += counters.sharedDirty;
+        totals.privateClean += counters.privateClean;
+        totals.privateDirty += counters.privateDirty;
+        totals.referenced += counters.referenced;
+        totals.anonymous += counters.anonymous;
+        totals.swap += counters.swap;
+        totals.swapPss += counters.swapPss;
+        totals.anonHugePages += counters.anonHugePages;
+        totals.hugetlb += counters.hugetlb;
+        totals.locked += counters.locked;
+    });
+}
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,213 @@
+// src/Core/Platform/Linux/SysfsLinux.cpp
+#include "SysfsLinux.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <dirent.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+int64 Exs_ReadSysfsFile(const char* path, char* buffer, size_t size) {
+    if (size == 0) {
+        return -1;
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    size_t total = 0;
+    while (total < size - 1) {
+        ssize_t bytesRead = read(fd, buffer + total, size - 1 - total);
+        if (bytesRead < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            return -1;
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        total += static_cast<size_t>(bytesRead);
+    }
+
+    close(fd);
+    buffer[total] = '\0';
+    return static_cast<int64>(total);
+}
+
+std::string Exs_ReadSysfsString(const std::string& path) {
+    char buffer[4096];
+    int64 length = Exs_ReadSysfsFile(path.c_str(), buffer, sizeof(buffer));
+    if (length <= 0) {
+        return "";
+    }
+
+    while (length > 0 && (buffer[length - 1] == '\n' || buffer[length - 1] == ' ' ||
+                          buffer[length - 1] == '\t' || buffer[length - 1] == '\r')) {
+        length--;
+    }
+    return std::string(buffer, static_cast<size_t>(length));
+}
+
+bool Exs_ReadSysfsUInt64(const std::string& path, uint64& value) {
+    char buffer[64];
+    if (Exs_ReadSysfsFile(path.c_str(), buffer, sizeof(buffer)) <= 0) {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = strtoull(buffer, &end, 0);
+    if (end == buffer || errno != 0) {
+        return false;
+    }
+
+    value = static_cast<uint64>(parsed);
+    return true;
+}
+
+static bool Exs_NaturalLess(const std::string& a, const std::string& b) {
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+        bool digitA = a[i] >= '0' && a[i] <= '9';
+        bool digitB = b[j] >= '0' && b[j] <= '9';
+        if (digitA && digitB) {
+            unsigned long long valueA = strtoull(a.c_str() + i, nullptr, 10);
+            unsigned long long valueB = strtoull(b.c_str() + j, nullptr, 10);
+            if (valueA != valueB) {
+                return valueA < valueB;
+            }
+            while (i < a.size() && a[i] >= '0' && a[i] <= '9') i++;
+            while (j < b.size() && b[j] >= '0' && b[j] <= '9') j++;
+            continue;
+        }
+        if (a[i] != b[j]) {
+            return a[i] < b[j];
+        }
+        i++;
+        j++;
+    }
+    return a.size() - i < b.size() - j;
+}
+
+std::vector<std::string> Exs_ListDirectory(const char* path, const char* prefix) {
+    std::vector<std::string> entries;
+    DIR* dir = opendir(path);
+    if (dir == nullptr) {
+        return entries;
+    }
+    size_t prefixLength = strlen(prefix);
+    while (struct dirent* entry = readdir(dir)) {
+        if (strncmp(entry->d_name, prefix, prefixLength) == 0) {
+            entries.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+
+    std::sort(entries.begin(), entries.end(), Exs_NaturalLess);
+    return entries;
+}
+
+std::vector<uint32> Exs_ParseCPUList(const char* text) {
+    std::vector<uint32> cpus;
+    if (text == nullptr) {
+        return cpus;
+    }
+
+    const char* cursor = text;
+    while (*cursor != '\0') {
+        while (*cursor == ',' || *cursor == ' ' || *cursor == '\n') {
+            cursor++;
+        }
+        if (*cursor < '0' || *cursor > '9') {
+            break;
+        }
+
+        char* end = nullptr;
+        unsigned long first = strtoul(cursor, &end, 10);
+        unsigned long last = first;
+        cursor = end;
+
+        if (*cursor == '-') {
+            last = strtoul(cursor + 1, &end, 10);
+            cursor = end;
+        }
+
+        for (unsigned long cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(static_cast<uint32>(cpu));
+        }
+    }
+
+    return cpus;
+}
+
+std::vector<uint32> Exs_GetOnlineCPUs() {
+    char buffer[4096];
+    if (Exs_ReadSysfsFile("/sys/devices/system/cpu/online", buffer, sizeof(buffer)) > 0) {
+        std::vector<uint32> cpus = Exs_ParseCPUList(buffer);
+        if (!cpus.empty()) {
+            return cpus;
+        }
+    }
+
+    // Fall back to a dense numbering
+    std::vector<uint32> cpus;
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    for (long cpu = 0; cpu < (count > 0 ? count : 1); cpu++) {
+        cpus.push_back(static_cast<uint32>(cpu));
+    }
+    return cpus;
+}
+
+uint64 Exs_GetBasePageSize() {
+    static const uint64 pageSize = [] {
+        long value = sysconf(_SC_PAGESIZE);
+        return value > 0 ? static_cast<uint64>(value) : 4096;
+    }();
+    return pageSize;
+}
+
+bool Exs_KeepLastSample(uint64 lastNs, uint32 minIntervalMs, bool haveResult) {
+    uint64 minIntervalNs = static_cast<uint64>(minIntervalMs) * 1000000ULL;
+    uint64 elapsedNs = Exs_GetMonotonicNanoseconds() - lastNs;
+    if (elapsedNs >= minIntervalNs) {
+        return false;
+    }
+    if (haveResult) {
+        return true;
+    }
+
+    uint64 remainingNs = minIntervalNs - elapsedNs;
+    timespec interval = { static_cast<time_t>(remainingNs / 1000000000ULL),
+                          static_cast<long>(remainingNs % 1000000000ULL) };
+    nanosleep(&interval, nullptr);
+    return false;
+}
+
+bool Exs_PinCurrentThreadToCPUs(const std::vector<uint32>& cpus) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint32 cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    if (CPU_COUNT(&cpuSet) == 0) {
+        return false;
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,56 @@
+// src/Core/Platform/Linux/SysfsLinux.h
+#ifndef EXS_LINUX_SYSFS_H
+#define EXS_LINUX_SYSFS_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <time.h>
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Reads a small sysfs/procfs file into a caller buffer without allocating.
+// Returns the number of bytes read (NUL-terminated), or -1 on failure.
+int64 Exs_ReadSysfsFile(const char* path, char* buffer, size_t size);
+
+// Convenience readers; trailing whitespace is stripped
+std::string Exs_ReadSysfsString(const std::string& path);
+bool Exs_ReadSysfsUInt64(const std::string& path, uint64& value);
+
+// Names in a directory starting with prefix, in natural order: digit runs
+// compare by value (hwmon9 < hwmon10) and a name sorts before its
+// extensions (intel-rapl:0 < intel-rapl:0:0)
+std::vector<std::string> Exs_ListDirectory(const char* path, const char* prefix);
+
+// Parses a kernel CPU list such as "0-3,8,10-11"
+std::vector<uint32> Exs_ParseCPUList(const char* text);
+
+// Logical CPUs currently online
+std::vector<uint32> Exs_GetOnlineCPUs();
+
+// Base page size in bytes; 4096 if sysconf cannot report it
+uint64 Exs_GetBasePageSize();
+
+// Restricts the calling thread to cpus; false if none of them can be used
+bool Exs_PinCurrentThreadToCPUs(const std::vector<uint32>& cpus);
+
+// CLOCK_MONOTONIC in nanoseconds; served by the vDSO, no kernel transition
+inline uint64 Exs_GetMonotonicNanoseconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64>(ts.tv_sec) * 1000000000ULL + static_cast<uint64>(ts.tv_nsec);
+}
+
+// Minimum interval between two readings of a differencing sampler whose
+// last reading was taken at lastNs. True when that reading is younger than
+// minIntervalMs and haveResult is set, i.e. the caller keeps its result;
+// without a result yet it sleeps out the rest and returns false.
+bool Exs_KeepLastSample(uint64 lastNs, uint32 minIntervalMs, bool haveResult);
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_LINUX_SYSFS_H
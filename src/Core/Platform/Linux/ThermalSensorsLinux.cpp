@@ -0,0 +1,236 @@
+// src/Core/Platform/Linux/ThermalSensorsLinux.cpp
+#include "../internal/ThermalSensors.h"
+#include "SysfsLinux.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <cstdlib>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ListDirectory;
+using Platform::Exs_ReadSysfsString;
+using Platform::Exs_ReadSysfsUInt64;
+
+// Highest tempN index probed per driver: one per core id for coretemp,
+// k10temp/zenpower Tctl, Tdie and Tccd1-12 at temp1-temp14
+constexpr uint32 kExs_CoretempLastInput = 255;
+constexpr uint32 kExs_K10tempLastInput = 16;
+
+void Exs_ClassifyThermalLabel(Exs_ThermalSensorInfo& info) {
+    const std::string& label = info.label;
+    if (label.compare(0, 11, "Package id ") == 0) {
+        info.kind = Exs_ThermalSensorKind::Package;
+        info.packageId = static_cast<uint32>(atoi(label.c_str() + 11));
+    } else if (label.compare(0, 5, "Core ") == 0) {
+        info.kind = Exs_ThermalSensorKind::Core;
+        info.coreId = static_cast<uint32>(atoi(label.c_str() + 5));
+    } else if (label == "Tctl" || label == "Tdie") {
+        info.kind = Exs_ThermalSensorKind::Package;
+    } else if (label.compare(0, 4, "Tccd") == 0) {
+        info.kind = Exs_ThermalSensorKind::Die;
+    } else {
+        info.kind = Exs_ThermalSensorKind::Other;
+    }
+}
+
+Exs_ThermalSensors::Exs_ThermalSensors() {
+    discoverHwmon();
+    if (sensors.empty()) {
+        discoverThermalZones();
+    }
+    mapCPUs();
+}
+
+Exs_ThermalSensors::~Exs_ThermalSensors() {
+    for (int fd : fds) {
+        close(fd);
+    }
+}
+
+void Exs_ThermalSensors::addInput(const std::string& path, const Exs_ThermalSensorInfo& info) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    sensors.push_back(info);
+    fds.push_back(fd);
+}
+
+void Exs_ThermalSensors::discoverHwmon() {
+    const char* root = "/sys/class/hwmon";
+    uint32 k10tempPackage = 0;
+
+    for (const std::string& hwmon : Exs_ListDirectory(root, "hwmon")) {
+        std::string base = std::string(root) + "/" + hwmon + "/";
+        std::string driver = Exs_ReadSysfsString(base + "name");
+        bool coretemp = driver == "coretemp";
+        bool k10temp = driver == "k10temp" || driver == "zenpower";
+        if (!coretemp && !k10temp) {
+            continue;
+        }
+
+        // coretemp names its package in a label; k10temp instances are one per package
+        size_t first = sensors.size();
+        uint32 packageId = k10temp ? k10tempPackage++ : 0;
+
+        // coretemp numbers inputs by core id, and k10temp hides Tdie without a
+        // Tctl offset and skips absent CCDs, so both leave gaps in the numbering
+        uint32 lastIndex = coretemp ? kExs_CoretempLastInput : kExs_K10tempLastInput;
+        for (uint32 index = 1; index <= lastIndex; index++) {
+            std::string prefix = base + "temp" + std::to_string(index) + "_";
+            std::string label = Exs_ReadSysfsString(prefix + "label");
+            if (label.empty()) {
+                if (access((prefix + "input").c_str(), F_OK) != 0) {
+                    continue;
+                }
+                label = "temp" + std::to_string(index);
+            }
+
+            Exs_ThermalSensorInfo info = {};
+            info.label = label;
+            info.packageId = packageId;
+            Exs_ClassifyThermalLabel(info);
+            if (info.kind == Exs_ThermalSensorKind::Package) {
+                packageId = info.packageId;
+            }
+
+            uint64 critical = 0;
+            if (Exs_ReadSysfsUInt64(prefix + "crit", critical)) {
+                info.criticalCelsius = static_cast<int32>(critical / 1000);
+            }
+
+            addInput(prefix + "input", info);
+        }
+
+        // Core inputs may precede the package label
+        for (size_t i = first; i < sensors.size(); i++) {
+            sensors[i].packageId = packageId;
+        }
+    }
+}
+
+void Exs_ThermalSensors::discoverThermalZones() {
+    const char* root = "/sys/class/thermal";
+    for (const std::string& zone : Exs_ListDirectory(root, "thermal_zone")) {
+        std::string base = std::string(root) + "/" + zone + "/";
+        std::string type = Exs_ReadSysfsString(base + "type");
+
+        Exs_ThermalSensorInfo info = {};
+        info.label = type;
+        if (type == "x86_pkg_temp") {
+            info.kind = Exs_ThermalSensorKind::Package;
+        } else if (type.find("cpu") != std::string::npos || type.find("soc") != std::string::npos) {
+            info.kind = Exs_ThermalSensorKind::Zone;
+        } else {
+            continue;
+        }
+
+        addInput(base + "temp", info);
+    }
+}
+
+void Exs_ThermalSensors::mapCPUs() {
+    std::vector<uint32> cpus = Platform::Exs_GetOnlineCPUs();
+    if (cpus.empty()) {
+        return;
+    }
+    cpuSensors.assign(cpus.back() + 1, -1);
+
+    for (uint32 cpu : cpus) {
+        std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        uint64 coreId = 0, packageId = 0;
+        Exs_ReadSysfsUInt64(topology + "core_id", coreId);
+        Exs_ReadSysfsUInt64(topology + "physical_package_id", packageId);
+
+        int32 packageSensor = -1, anySensor = -1;
+        for (size_t i = 0; i < sensors.size(); i++) {
+            const Exs_ThermalSensorInfo& sensor = sensors[i];
+            if (anySensor < 0) {
+                anySensor = static_cast<int32>(i);
+            }
+            if (sensor.packageId != packageId && sensor.kind != Exs_ThermalSensorKind::Zone) {
+                continue;
+            }
+            if (sensor.kind == Exs_ThermalSensorKind::Core && sensor.coreId == coreId) {
+                cpuSensors[cpu] = static_cast<int32>(i);
+                break;
+            }
+            if (sensor.kind == Exs_ThermalSensorKind::Package && packageSensor < 0) {
+                packageSensor = static_cast<int32>(i);
+            }
+        }
+
+        if (cpuSensors[cpu] < 0) {
+            cpuSensors[cpu] = packageSensor >= 0 ? packageSensor : anySensor;
+        }
+    }
+}
+
+const std::vector<Exs_ThermalSensorInfo>& Exs_ThermalSensors::getSensors() const {
+    return sensors;
+}
+
+int32 Exs_ThermalSensors::getSensorForCPU(uint32 cpu) const {
+    return cpu < cpuSensors.size() ? cpuSensors[cpu] : -1;
+}
+
+bool Exs_ThermalSensors::readAll(std::vector<int32>& milliCelsius) const {
+    milliCelsius.assign(fds.size(), INT32_MIN);
+
+    bool anyRead = false;
+    char buffer[24];
+    for (size_t i = 0; i < fds.size(); i++) {
+        ssize_t bytes = pread(fds[i], buffer, sizeof(buffer) - 1, 0);
+        if (bytes <= 0) {
+            continue;
+        }
+        buffer[bytes] = '\0';
+        milliCelsius[i] = static_cast<int32>(strtol(buffer, nullptr, 10));
+        anyRead = true;
+    }
+    return anyRead;
+}
+
+int32 Exs_ThermalSensors::readHottestPackage() const {
+    std::vector<int32> values;
+    if (!readAll(values)) {
+        return 0;
+    }
+
+    int32 hottestPackage = INT32_MIN, hottest = INT32_MIN;
+    for (size_t i = 0; i < values.size(); i++) {
+        hottest = std::max(hottest, values[i]);
+        if (sensors[i].kind == Exs_ThermalSensorKind::Package) {
+            hottestPackage = std::max(hottestPackage, values[i]);
+        }
+    }
+
+    int32 result = hottestPackage != INT32_MIN ? hottestPackage : hottest;
+    return result == INT32_MIN ? 0 : result / 1000;
+}
+
+std::vector<int32> Exs_ThermalSensors::readCPUTemperatures(const std::vector<uint32>& cpus) const {
+    std::vector<int32> temperatures(cpus.size(), 0);
+
+    std::vector<int32> values;
+    if (!readAll(values)) {
+        return temperatures;
+    }
+
+    for (size_t i = 0; i < cpus.size(); i++) {
+        int32 sensor = getSensorForCPU(cpus[i]);
+        if (sensor >= 0 && values[static_cast<size_t>(sensor)] != INT32_MIN) {
+            temperatures[i] = values[static_cast<size_t>(sensor)] / 1000;
+        }
+    }
+    return temperatures;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,70 @@
+// src/Core/Platform/Linux/ThreadPoolLinux.cpp
+#include "../internal/ThreadPool.h"
+#include "../internal/CacheTopology.h"
+#include "../internal/NumaMemory.h"
+#include "SysfsLinux.h"
+#include <sched.h>
+#include <algorithm>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+static uint32 Exs_FirstCPUInList(const std::string& path, uint32 fallback) {
+    std::string list = Exs_ReadSysfsString(path);
+    std::vector<uint32> cpus = Exs_ParseCPUList(list.c_str());
+    return cpus.empty() ? fallback : cpus.front();
+}
+
+std::vector<Exs_WorkerPlacement> Exs_DetectWorkerPlacements(Exs_ThreadPinningPolicy policy) {
+    std::vector<Exs_WorkerPlacement> placements;
+
+    // Restrict to the CPUs this process may run on (cgroups, taskset)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool haveAffinity = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    for (uint32 cpu : Exs_GetOnlineCPUs()) {
+        if (haveAffinity && cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &allowed)) {
+            continue;
+        }
+
+        std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+
+        Exs_WorkerPlacement placement;
+        placement.cpu = cpu;
+        placement.coreKey = Exs_FirstCPUInList(topology + "thread_siblings_list", cpu);
+        const CPUInfo::Exs_CacheDomain* cache = CPUInfo::Exs_GetCacheDomainOfCPU(cpu, 0);
+        placement.cacheKey = cache != nullptr ? cache->cpus.front() : cpu;
+        placement.numaNodeId = MemoryInfo::Exs_GetNumaNodeOfCPU(cpu);
+
+        uint64 package = 0;
+        placement.socketId = Exs_ReadSysfsUInt64(topology + "physical_package_id", package)
+            ? static_cast<uint32>(package)
+            : 0;
+        placement.isHyperThread = placement.coreKey != cpu;
+
+        if (policy == Exs_ThreadPinningPolicy::PhysicalCores && placement.isHyperThread) {
+            continue;
+        }
+        placements.push_back(placement);
+    }
+
+    // Keep workers of one cache domain next to each other
+    std::stable_sort(placements.begin(), placements.end(),
+                     [](const Exs_WorkerPlacement& a, const Exs_WorkerPlacement& b) {
+        if (a.numaNodeId != b.numaNodeId) return a.numaNodeId < b.numaNodeId;
+        if (a.cacheKey != b.cacheKey) return a.cacheKey < b.cacheKey;
+        return a.cpu < b.cpu;
+    });
+
+    return placements;
+}
+
+bool Exs_PinCurrentThreadToCPU(uint32 cpu) {
+    return Exs_PinCurrentThreadToCPUs({ cpu });
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
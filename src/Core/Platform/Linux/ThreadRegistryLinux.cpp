@@ -0,0 +1,212 @@
+// src/Core/Platform/Linux/ThreadRegistryLinux.cpp
+#include "../internal/ThreadRegistry.h"
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// One registry slot; written only by its owning thread, guarded by a seqlock
+struct alignas(64) Exs_ThreadSlot {
+    std::atomic<uint32> claimed{0};
+    std::atomic<uint32> sequence{0};
+    Exs_ThreadRecord record;
+};
+
+static Exs_ThreadSlot s_threadSlots[kExs_MaxRegisteredThreads];
+static std::atomic<uint32> s_threadSlotHighWater{0};
+
+// Releases the calling thread's slot when the thread exits
+struct Exs_ThreadSlotOwner {
+    int32 slot = -1;
+
+    ~Exs_ThreadSlotOwner() {
+        Exs_UnregisterCurrentThread();
+    }
+};
+
+static thread_local Exs_ThreadSlotOwner t_threadSlotOwner;
+
+static void Exs_ResetThreadStateInChild() {
+    // Only the forking thread survives in the child, and its kernel id changed
+    t_exsOSThreadId = 0;
+    t_threadSlotOwner.slot = -1;
+
+    uint32 highWater = s_threadSlotHighWater.load(std::memory_order_relaxed);
+    for (uint32 i = 0; i < highWater; i++) {
+        s_threadSlots[i].claimed.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint32 Exs_QueryOSThreadId() {
+    static std::once_flag atforkOnce;
+    std::call_once(atforkOnce, []() {
+        pthread_atfork(nullptr, nullptr, &Exs_ResetThreadStateInChild);
+    });
+
+    return static_cast<uint32>(syscall(SYS_gettid));
+}
+
+static void Exs_CopyName(char* destination, const char* source) {
+    if (source == nullptr) {
+        destination[0] = '\0';
+        return;
+    }
+    strncpy(destination, source, kExs_ThreadNameLength - 1);
+    destination[kExs_ThreadNameLength - 1] = '\0';
+}
+
+static void Exs_ReadAffinity(Exs_ThreadRecord& record) {
+    memset(record.affinityMask, 0, sizeof(record.affinityMask));
+    record.affinityCPUCount = 0;
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        return;
+    }
+
+    uint32 limit = CPU_SETSIZE < kExs_MaxAffinityCPUs ? CPU_SETSIZE : kExs_MaxAffinityCPUs;
+    for (uint32 cpu = 0; cpu < limit; cpu++) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            record.affinityMask[cpu / 64] |= 1ULL << (cpu % 64);
+            record.affinityCPUCount++;
+        }
+    }
+}
+
+// Seqlock write of the caller's own slot
+template <typename Update>
+static void Exs_WriteSlot(Exs_ThreadSlot& slot, Update update) {
+    uint32 sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    update(slot.record);
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Seqlock read; retries while the owner is mid-update
+static bool Exs_ReadSlot(const Exs_ThreadSlot& slot, Exs_ThreadRecord& record) {
+    for (;;) {
+        if (slot.claimed.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        uint32 before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+
+        memcpy(&record, &slot.record, sizeof(record));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        uint32 after = slot.sequence.load(std::memory_order_relaxed);
+        if (before == after) {
+            return record.threadId != 0;
+        }
+    }
+}
+
+bool Exs_RegisterCurrentThread(const char* name, const char* role) {
+    int32 slotIndex = t_threadSlotOwner.slot;
+
+    if (slotIndex < 0) {
+        for (uint32 i = 0; i < kExs_MaxRegisteredThreads; i++) {
+            uint32 expected = 0;
+            if (s_threadSlots[i].claimed.compare_exchange_strong(expected, 1,
+                                                                  std::memory_order_acq_rel)) {
+                slotIndex = static_cast<int32>(i);
+                break;
+            }
+        }
+        if (slotIndex < 0) {
+            return false;
+        }
+
+        // Publish the new high-water mark for readers
+        uint32 highWater = s_threadSlotHighWater.load(std::memory_order_relaxed);
+        while (highWater < static_cast<uint32>(slotIndex) + 1 &&
+               !s_threadSlotHighWater.compare_exchange_weak(highWater,
+                                                            static_cast<uint32>(slotIndex) + 1,
+                                                            std::memory_order_release)) {
+        }
+        t_threadSlotOwner.slot = slotIndex;
+    }
+
+    uint32 threadId = Exs_GetOSThreadId();
+    Exs_WriteSlot(s_threadSlots[slotIndex], [&](Exs_ThreadRecord& record) {
+        record.threadId = threadId;
+        Exs_CopyName(record.name, name);
+        Exs_CopyName(record.role, role);
+        Exs_ReadAffinity(record);
+    });
+
+    if (name != nullptr) {
+        // Linux limits thread names to 15 characters plus the terminator
+        char osName[16];
+        strncpy(osName, name, sizeof(osName) - 1);
+        osName[sizeof(osName) - 1] = '\0';
+        pthread_setname_np(pthread_self(), osName);
+    }
+    return true;
+}
+
+void Exs_UnregisterCurrentThread() {
+    int32 slotIndex = t_threadSlotOwner.slot;
+    if (slotIndex < 0) {
+        return;
+    }
+
+    Exs_ThreadSlot& slot = s_threadSlots[slotIndex];
+    Exs_WriteSlot(slot, [](Exs_ThreadRecord& record) {
+        record.threadId = 0;
+    });
+    slot.claimed.store(0, std::memory_order_release);
+    t_threadSlotOwner.slot = -1;
+}
+
+void Exs_RefreshCurrentThreadAffinity() {
+    int32 slotIndex = t_threadSlotOwner.slot;
+    if (slotIndex < 0) {
+        return;
+    }
+
+    Exs_WriteSlot(s_threadSlots[slotIndex], [](Exs_ThreadRecord& record) {
+        Exs_ReadAffinity(record);
+    });
+}
+
+bool Exs_LookupThread(uint32 threadId, Exs_ThreadRecord& record) {
+    uint32 highWater = s_threadSlotHighWater.load(std::memory_order_acquire);
+    for (uint32 i = 0; i < highWater; i++) {
+        if (Exs_ReadSlot(s_threadSlots[i], record) && record.threadId == threadId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<Exs_ThreadRecord> Exs_SnapshotThreadRegistry() {
+    std::vector<Exs_ThreadRecord> records;
+    uint32 highWater = s_threadSlotHighWater.load(std::memory_order_acquire);
+
+    Exs_ThreadRecord record;
+    for (uint32 i = 0; i < highWater; i++) {
+        if (Exs_ReadSlot(s_threadSlots[i], record)) {
+            records.push_back(record);
+        }
+    }
+    return records;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
@@ -0,0 +1,233 @@
+// src/Core/Platform/Linux/TopologyTreeLinux.cpp
+#include "../internal/TopologyTree.h"
+#include "../internal/CoreTypes.h"
+#include "SysfsLinux.h"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+using Platform::Exs_ReadSysfsFile;
+using Platform::Exs_ParseCPUList;
+
+constexpr uint32 kExs_TopologyAbsent = UINT32_MAX;
+
+// Everything the tree needs about one logical CPU
+struct Exs_TopologyCPURecord {
+    uint32 cpu;
+    uint32 packageId;
+    uint32 nodeId;
+    uint32 l3Id;     // kExs_TopologyAbsent without an L3
+    uint32 l3SizeKB;
+    uint32 l2Id;     // kExs_TopologyAbsent without an L2
+    uint32 l2SizeKB;
+    uint32 coreId;
+};
+
+// Stack-buffer reads; large machines need thousands of them
+static bool Exs_ReadTopologyValue(const char* path, char* buffer, size_t size) {
+    return Exs_ReadSysfsFile(path, buffer, size) > 0;
+}
+
+static uint32 Exs_ReadTopologyUInt32(const char* path, uint32 fallback) {
+    char buffer[32];
+    return Exs_ReadTopologyValue(path, buffer, sizeof(buffer)) ? static_cast<uint32>(strtoul(buffer, nullptr, 10))
+                                                                : fallback;
+}
+
+// "48K" / "32M" -> KB
+static uint32 Exs_ReadTopologyCacheSize(const char* path) {
+    char buffer[32];
+    if (!Exs_ReadTopologyValue(path, buffer, sizeof(buffer))) {
+        return 0;
+    }
+    char* end = nullptr;
+    uint64 value = strtoull(buffer, &end, 10);
+    if (end != nullptr && *end == 'M') {
+        value *= 1024;
+    }
+    return static_cast<uint32>(value);
+}
+
+static void Exs_ReadCPURecordCaches(Exs_TopologyCPURecord& record) {
+    char path[128];
+    char buffer[64];
+
+    for (uint32 index = 0; index < 16; index++) {
+        int prefix = snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/", record.cpu, index);
+        if (prefix <= 0 || static_cast<size_t>(prefix) >= sizeof(path) - 32) {
+            return;
+        }
+        char* leaf = path + prefix;
+
+        strcpy(leaf, "level");
+        uint32 level = Exs_ReadTopologyUInt32(path, 0);
+        if (level == 0) {
+            return;
+        }
+        if (level != 2 && level != 3) {
+            continue;
+        }
+
+        strcpy(leaf, "type");
+        if (Exs_ReadTopologyValue(path, buffer, sizeof(buffer)) && strncmp(buffer, "Instruction", 11) == 0) {
+            continue;
+        }
+
+        // Without an id the first sharer names the instance
+        strcpy(leaf, "id");
+        uint32 id = Exs_ReadTopologyUInt32(path, kExs_TopologyAbsent);
+        if (id == kExs_TopologyAbsent) {
+            strcpy(leaf, "shared_cpu_list");
+            id = Exs_ReadTopologyValue(path, buffer, sizeof(buffer))
+                ? static_cast<uint32>(strtoul(buffer, nullptr, 10))
+                : record.cpu;
+        }
+
+        strcpy(leaf, "size");
+        uint32 sizeKB = Exs_ReadTopologyCacheSize(path);
+
+        if (level == 3) {
+            record.l3Id = id;
+            record.l3SizeKB = sizeKB;
+        } else {
+            record.l2Id = id;
+            record.l2SizeKB = sizeKB;
+        }
+    }
+}
+
+// The single sysfs pass: node CPU lists, then topology and caches per CPU
+static std::vector<Exs_TopologyCPURecord> Exs_ReadTopologyRecords() {
+    std::vector<uint32> online = Platform::Exs_GetOnlineCPUs();
+    std::vector<uint32> nodeOfCPU(online.empty() ? 0 : online.back() + 1, 0);
+
+    char path[128];
+    char buffer[4096];
+    if (Exs_ReadTopologyValue("/sys/devices/system/node/online", buffer, sizeof(buffer))) {
+        for (uint32 node : Exs_ParseCPUList(buffer)) {
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+            if (!Exs_ReadTopologyValue(path, buffer, sizeof(buffer))) {
+                continue;
+            }
+            for (uint32 cpu : Exs_ParseCPUList(buffer)) {
+                if (cpu < nodeOfCPU.size()) {
+                    nodeOfCPU[cpu] = node;
+                }
+            }
+        }
+    }
+
+    std::vector<Exs_TopologyCPURecord> records;
+    records.reserve(online.size());
+    for (uint32 cpu : online) {
+        Exs_TopologyCPURecord record = {};
+        record.cpu = cpu;
+        record.nodeId = nodeOfCPU[cpu];
+        record.l3Id = kExs_TopologyAbsent;
+        record.l2Id = kExs_TopologyAbsent;
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+        record.packageId = Exs_ReadTopologyUInt32(path, 0);
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+        record.coreId = Exs_ReadTopologyUInt32(path, cpu);
+
+        Exs_ReadCPURecordCaches(record);
+        records.push_back(record);
+    }
+    return records;
+}
+
+// Descends to (or creates) the child with this type and id. Records arrive
+// sorted by every level's key, so a matching child is always the last one.
+static Exs_TopologyNode& Exs_GetTopologyChild(Exs_TopologyNode& parent, Exs_TopologyNodeType type,
+                                              uint32 id, uint32 sizeKB) {
+    if (parent.children.empty() || parent.children.back().type != type || parent.children.back().id != id) {
+        Exs_TopologyNode child = {};
+        child.type = type;
+        child.id = id;
+        child.sizeKB = sizeKB;
+        child.coreType = Exs_CPUCoreType::Unknown;
+        parent.children.push_back(child);
+    }
+    return parent.children.back();
+}
+
+static Exs_TopologyNode Exs_BuildTopologyTree() {
+    std::vector<Exs_TopologyCPURecord> records = Exs_ReadTopologyRecords();
+
+    std::sort(records.begin(), records.end(), [](const Exs_TopologyCPURecord& a, const Exs_TopologyCPURecord& b) {
+        if (a.packageId != b.packageId) return a.packageId < b.packageId;
+        if (a.nodeId != b.nodeId) return a.nodeId < b.nodeId;
+        if (a.l3Id != b.l3Id) return a.l3Id < b.l3Id;
+        if (a.l2Id != b.l2Id) return a.l2Id < b.l2Id;
+        if (a.coreId != b.coreId) return a.coreId < b.coreId;
+        return a.cpu < b.cpu;
+    });
+
+    Exs_TopologyNode root = {};
+    root.type = Exs_TopologyNodeType::Machine;
+    root.coreType = Exs_CPUCoreType::Unknown;
+
+    for (const Exs_TopologyCPURecord& record : records) {
+        const Exs_CoreTypeInfo* coreType = Exs_GetCoreTypeOfCPU(record.cpu);
+
+        Exs_TopologyNode* node = &root;
+        node->cpus.push_back(record.cpu);
+
+        node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::Package, record.packageId, 0);
+        node->cpus.push_back(record.cpu);
+
+        node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::NumaNode, record.nodeId, 0);
+        node->cpus.push_back(record.cpu);
+
+        if (record.l3Id != kExs_TopologyAbsent) {
+            node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::L3Cache, record.l3Id, record.l3SizeKB);
+            node->cpus.push_back(record.cpu);
+        }
+        if (record.l2Id != kExs_TopologyAbsent) {
+            node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::L2Cache, record.l2Id, record.l2SizeKB);
+            node->cpus.push_back(record.cpu);
+        }
+
+        node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::Core, record.coreId, 0);
+        node->cpus.push_back(record.cpu);
+        node->coreType = coreType != nullptr ? coreType->type : Exs_CPUCoreType::Unknown;
+
+        node = &Exs_GetTopologyChild(*node, Exs_TopologyNodeType::PU, record.cpu, 0);
+        node->cpus.push_back(record.cpu);
+        node->coreType = coreType != nullptr ? coreType->type : Exs_CPUCoreType::Unknown;
+    }
+
+    // Sorting by cache and core ids can interleave CPU numbers
+    std::vector<Exs_TopologyNode*> stack = { &root };
+    while (!stack.empty()) {
+        Exs_TopologyNode* node = stack.back();
+        stack.pop_back();
+        std::sort(node->cpus.begin(), node->cpus.end());
+        for (Exs_TopologyNode& child : node->children) {
+            stack.push_back(&child);
+        }
+    }
+
+    return root;
+}
+
+const Exs_TopologyNode& Exs_GetTopologyTree() {
+    static const Exs_TopologyNode tree = Exs_BuildTopologyTree();
+    return tree;
+}
+
+const std::string& Exs_GetTopologyJSON() {
+    static const std::string json = Exs_TopologyToJSON(Exs_GetTopologyTree());
+    return json;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
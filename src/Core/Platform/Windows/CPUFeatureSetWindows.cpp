@@ -0,0 +1,48 @@
+// src/Core/Platform/Windows/CPUFeatureSetWindows.cpp
+#include "../internal/CPUFeatureSet.h"
+#include <windows.h>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+#if defined(_M_ARM64)
+static void Exs_DetectARMFeatures(Exs_CPUFeatureSet& set) {
+    // Advanced SIMD and FP are mandatory on ARMv8
+    set.set(Exs_CPUFeature::FP);
+    set.set(Exs_CPUFeature::ASIMD);
+
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE)) {
+        set.set(Exs_CPUFeature::AES);
+        set.set(Exs_CPUFeature::PMULL);
+        set.set(Exs_CPUFeature::SHA1);
+        set.set(Exs_CPUFeature::SHA2);
+    }
+    set.set(Exs_CPUFeature::CRC32, IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0);
+#if defined(PF_ARM_V81_ATOMIC_INSTRUCTIONS_AVAILABLE)
+    set.set(Exs_CPUFeature::ATOMICS, IsProcessorFeaturePresent(PF_ARM_V81_ATOMIC_INSTRUCTIONS_AVAILABLE) != 0);
+#endif
+#if defined(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)
+    set.set(Exs_CPUFeature::ASIMDDP, IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE) != 0);
+#endif
+}
+#endif
+
+static Exs_CPUFeatureSet Exs_DetectCPUFeatureSet() {
+    Exs_CPUFeatureSet set;
+#if defined(_M_X64) || defined(_M_IX86)
+    Exs_DetectX86CPUFeatures(set);
+#elif defined(_M_ARM64)
+    Exs_DetectARMFeatures(set);
+#endif
+    return set;
+}
+
+const Exs_CPUFeatureSet& Exs_GetCPUFeatureSet() {
+    static const Exs_CPUFeatureSet features = Exs_DetectCPUFeatureSet();
+    return features;
+}
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
@@ -1,5 +1,7 @@
 // src/Core/Platform/Windows/CPUInfoWindows.cpp
 #include "../internal/CPUInfoBase.h"
+#include "../internal/CPUFeatureSet.h"
+#include "../internal/CPUID.h"
 #include <windows.h>
 #include <intrin.h>
 #include <pdh.h>
@@ -8,6 +10,7 @@
 #include <wmicom.h>
 #include <comdef.h>
 #include <wbemidl.h>
+#include <powrprof.h>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -16,24 +19,52 @@
 
 #pragma comment(lib, "pdh.lib")
 #pragma comment(lib, "wbemuuid.lib")
+#pragma comment(lib, "powrprof.lib")
 
 namespace Exs {
 namespace Internal {
 namespace CPUInfo {
 
-// CPUID function
-void Exs_CPUID(int32 cpuInfo[4], int32 functionId) {
-    __cpuid(cpuInfo, functionId);
+// Mirrors PROCESSOR_POWER_INFORMATION, which the SDK headers do not declare
+struct Exs_ProcessorPowerInformation {
+    ULONG Number;
+    ULONG MaxMhz;
+    ULONG CurrentMhz;
+    ULONG MhzLimit;
+    ULONG MaxIdleState;
+    ULONG CurrentIdleState;
+};
+
+// Maximum frequency of every logical processor, indexed by group * 64 + bit
+static std::vector<ULONG> Exs_GetProcessorMaxMHz() {
+    std::vector<Exs_ProcessorPowerInformation> power(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+    std::vector<ULONG> maxMHz;
+    if (power.empty() ||
+        CallNtPowerInformation(ProcessorInformation, nullptr, 0, power.data(),
+                               static_cast<ULONG>(power.size() * sizeof(power[0]))) != 0) {
+        return maxMHz;
+    }
+    for (const auto& processor : power) {
+        if (processor.Number >= maxMHz.size()) {
+            maxMHz.resize(processor.Number + 1, 0);
+        }
+        maxMHz[processor.Number] = processor.MaxMhz;
+    }
+    return maxMHz;
 }
 
 // CPUID with extended function
 void Exs_CPUIDEX(int32 cpuInfo[4], int32 functionId, int32 subfunctionId) {
-    __cpuidex(cpuInfo, functionId, subfunctionId);
+    uint32 registers[4] = {0};
+    Exs_ReadCPUID(static_cast<uint32>(functionId), static_cast<uint32>(subfunctionId), registers);
+    for (int32 i = 0; i < 4; i++) {
+        cpuInfo[i] = static_cast<int32>(registers[i]);
+    }
 }
 
-// Get xgetbv
-uint64 Exs_xgetbv(uint32 index) {
-    return _xgetbv(index);
+// CPUID function
+void Exs_CPUID(int32 cpuInfo[4], int32 functionId) {
+    Exs_CPUIDEX(cpuInfo, functionId, 0);
 }
 
 class Exs_CPUInfoWindows : public Exs_CPUInfoBase {
@@ -396,6 +427,9 @@ public:
             return coreInfo;
         }
         
+        std::vector<ULONG> processorMaxMHz = Exs_GetProcessorMaxMHz();
+        std::vector<ULONG> coreMaxMHz;
+
         if (GetLogicalProcessorInformationEx(RelationProcessorCore, buffer, &bufferSize)) {
             DWORD byteOffset = 0;
             PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX ptr = buffer;
@@ -414,6 +448,20 @@ public:
                     info.utilizationPercentage = getCoreUsage(coreIndex);
                     info.isHyperThread = (ptr->Processor.GroupCount > 1);
                     
+                    // Higher efficiency class = faster core; resolved to a type below
+                    info.coreType = Exs_CPUCoreType::Unknown;
+                    info.relativeCapacity = ptr->Processor.EfficiencyClass;
+
+                    // Maximum frequency of the core's first logical processor
+                    const GROUP_AFFINITY& affinity = ptr->Processor.GroupMask[0];
+                    DWORD bit = 0;
+                    ULONG maxMHz = 0;
+                    if (_BitScanForward64(&bit, affinity.Mask)) {
+                        size_t processor = static_cast<size_t>(affinity.Group) * 64 + bit;
+                        maxMHz = processor < processorMaxMHz.size() ? processorMaxMHz[processor] : 0;
+                    }
+                    coreMaxMHz.push_back(maxMHz);
+                    
                     coreInfo.push_back(info);
                     coreIndex++;
                 }
@@ -424,6 +472,41 @@ public:
         }
         
         free(buffer);
+        
+        // Hybrid parts report more than one efficiency class; only the
+        // highest class is Performance, every class below it is Efficiency
+        std::vector<BYTE> classes;
+        ULONG fastestMHz = 0;
+        bool distinctMHz = false;
+        for (size_t i = 0; i < coreInfo.size(); i++) {
+            BYTE efficiencyClass = static_cast<BYTE>(coreInfo[i].relativeCapacity);
+            if (std::find(classes.begin(), classes.end(), efficiencyClass) == classes.end()) {
+                classes.push_back(efficiencyClass);
+            }
+            distinctMHz = distinctMHz || (fastestMHz != 0 && coreMaxMHz[i] != 0 && coreMaxMHz[i] != fastestMHz);
+            fastestMHz = (std::max)(fastestMHz, coreMaxMHz[i]);
+        }
+        std::sort(classes.begin(), classes.end());
+
+        for (size_t i = 0; i < coreInfo.size(); i++) {
+            Exs_CPUCoreInfo& info = coreInfo[i];
+            BYTE efficiencyClass = static_cast<BYTE>(info.relativeCapacity);
+            bool efficiency = efficiencyClass != classes.back();
+            info.coreType = efficiency ? Exs_CPUCoreType::Efficiency : Exs_CPUCoreType::Performance;
+
+            // Classes are only ordinal. When Windows reports different
+            // maximum frequencies, capacity follows them; otherwise each
+            // class gets an equal step of the range (3 classes: 341, 683, 1024).
+            if (!efficiency) {
+                info.relativeCapacity = 1024;
+            } else if (distinctMHz && coreMaxMHz[i] != 0) {
+                info.relativeCapacity = static_cast<uint32>((std::max<ULONG>)(1, coreMaxMHz[i] * 1024 / fastestMHz));
+            } else {
+                size_t rank = std::find(classes.begin(), classes.end(), efficiencyClass) - classes.begin();
+                info.relativeCapacity = static_cast<uint32>((rank + 1) * 1024 / classes.size());
+            }
+        }
+        
         return coreInfo;
     }
     
@@ -440,59 +523,35 @@ public:
             return cpuFeaturesCache;
         }
         
-        int32 cpuInfo[4] = {0};
-        
-        // Get standard features
-        Exs_CPUID(cpuInfo, 1);
-        
-        cpuFeaturesCache.mmx    = (cpuInfo[3] & (1 << 23)) != 0;
-        cpuFeaturesCache.sse    = (cpuInfo[3] & (1 << 25)) != 0;
-        cpuFeaturesCache.sse2   = (cpuInfo[3] & (1 << 26)) != 0;
-        cpuFeaturesCache.sse3   = (cpuInfo[2] & (1 << 0)) != 0;
-        cpuFeaturesCache.ssse3  = (cpuInfo[2] & (1 << 9)) != 0;
-        cpuFeaturesCache.sse4_1 = (cpuInfo[2] & (1 << 19)) != 0;
-        cpuFeaturesCache.sse4_2 = (cpuInfo[2] & (1 << 20)) != 0;
-        cpuFeaturesCache.aes    = (cpuInfo[2] & (1 << 25)) != 0;
-        
-        // Check AVX
-        bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
-        cpuFeaturesCache.avx = (cpuInfo[2] & (1 << 28)) != 0 && osxsave;
-        
-        // Get extended features
-        Exs_CPUID(cpuInfo, 7);
-        
-        cpuFeaturesCache.avx2 = (cpuInfo[1] & (1 << 5)) != 0;
-        cpuFeaturesCache.avx512 = (cpuInfo[1] & (1 << 16)) != 0;
-        cpuFeaturesCache.fma = (cpuInfo[1] & (1 << 12)) != 0;
-        
-        // Check virtualization
-        cpuFeaturesCache.vmx = (cpuInfo[1] & (1 << 5)) != 0; // Actually for AVX2
-        cpuFeaturesCache.svm = false; // AMD specific
-        
-        // Get additional info
-        Exs_CPUID(cpuInfo, 0x80000001);
-        cpuFeaturesCache.hypervisor = (cpuInfo[2] & (1 << 31)) != 0;
+        // Summary flags derived from the full bitmap
+        const Exs_CPUFeatureSet& set = Exs_GetCPUFeatureSet();
+        cpuFeaturesCache.mmx    = set.has(Exs_CPUFeature::MMX);
+        cpuFeaturesCache.sse    = set.has(Exs_CPUFeature::SSE);
+        cpuFeaturesCache.sse2   = set.has(Exs_CPUFeature::SSE2);
+        cpuFeaturesCache.sse3   = set.has(Exs_CPUFeature::SSE3);
+        cpuFeaturesCache.ssse3  = set.has(Exs_CPUFeature::SSSE3);
+        cpuFeaturesCache.sse4_1 = set.has(Exs_CPUFeature::SSE4_1);
+        cpuFeaturesCache.sse4_2 = set.has(Exs_CPUFeature::SSE4_2);
+        cpuFeaturesCache.aes    = set.has(Exs_CPUFeature::AES);
+        cpuFeaturesCache.avx    = set.has(Exs_CPUFeature::AVX);
+        cpuFeaturesCache.avx2   = set.has(Exs_CPUFeature::AVX2);
+        cpuFeaturesCache.avx512 = set.has(Exs_CPUFeature::AVX512F);
+        cpuFeaturesCache.fma    = set.has(Exs_CPUFeature::FMA);
+        cpuFeaturesCache.neon   = set.has(Exs_CPUFeature::ASIMD);
+        cpuFeaturesCache.asimd  = set.has(Exs_CPUFeature::ASIMD);
+        cpuFeaturesCache.crypto = set.has(Exs_CPUFeature::AES) && set.has(Exs_CPUFeature::SHA1);
+        cpuFeaturesCache.vmx    = set.has(Exs_CPUFeature::VMX);
+        cpuFeaturesCache.svm    = set.has(Exs_CPUFeature::SVM);
+        cpuFeaturesCache.hypervisor = set.has(Exs_CPUFeature::HYPERVISOR);
+        cpuFeaturesCache.sgx    = set.has(Exs_CPUFeature::SGX);
         
         featuresInitialized = true;
         return cpuFeaturesCache;
     }
     
     bool supportsFeature(const std::string& feature) const override {
-        auto features = getCPUFeatures();
-        
-        if (feature == "SSE") return features.sse;
-        if (feature == "SSE2") return features.sse2;
-        if (feature == "SSE3") return features.sse3;
-        if (feature == "SSSE3") return features.ssse3;
-        if (feature == "SSE4.1") return features.sse4_1;
-        if (feature == "SSE4.2") return features.sse4_2;
-        if (feature == "AVX") return features.avx;
-        if (feature == "AVX2") return features.avx2;
-        if (feature == "AVX512") return features.avx512;
-        if (feature == "FMA") return features.fma;
-        if (feature == "AES") return features.aes;
-        
-        return false;
+        Exs_CPUFeature id;
+        return Exs_FindCPUFeature(feature, id) && Exs_GetCPUFeatureSet().has(id);
     }
     
     double getTotalCPUUsage() const override {
@@ -670,6 +729,11 @@ public:
         return ss.str();
     }
     
+    // No topology tree is built on Windows yet
+    std::string getTopologyJSON() const override {
+        return std::string();
+    }
+    
     bool supportsVirtualization() const override {
         int32 cpuInfo[4] = {0};
         Exs_CPUID(cpuInfo, 1);
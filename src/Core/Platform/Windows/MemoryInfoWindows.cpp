@@ -537,14 +537,9 @@ public:
         return false;
     }
     
+    // No stall accounting here; dwMemoryLoad is RAM usage, not pressure
     double getMemoryPressurePercentage() const override {
-        MEMORYSTATUSEX memStatus;
-        memStatus.dwLength = sizeof(memStatus);
-        
-        if (GlobalMemoryStatusEx(&memStatus)) {
-            return static_cast<double>(memStatus.dwMemoryLoad);
-        }
-        return 0.0;
+        return kExs_PressureUnavailable;
     }
     
     double getMemoryFragmentation() const override {
@@ -1,5 +1,7 @@
 // src/Core/Platform/Windows/PlatformWindows.cpp
 #include "../internal/PlatformBase.h"
+#include "../internal/PlatformDescriptor.h"
+#include "../internal/CPUFeatureSet.h"
 #include <windows.h>
 #include <versionhelpers.h>
 #include <intrin.h>
@@ -11,121 +13,159 @@ namespace Exs {
 namespace Internal {
 namespace Platform {
 
+static uint32 Exs_CountPhysicalCores() {
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* buffer = nullptr;
+    DWORD bufferSize = 0;
+    
+    GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &bufferSize);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+        return 0;
+    }
+    
+    buffer = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)malloc(bufferSize);
+    if (!buffer) {
+        return 0;
+    }
+    
+    uint32 coreCount = 0;
+    if (GetLogicalProcessorInformationEx(RelationProcessorCore, buffer, &bufferSize)) {
+        BYTE* ptr = (BYTE*)buffer;
+        DWORD offset = 0;
+        
+        while (offset < bufferSize) {
+            SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info = 
+                (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(ptr + offset);
+            
+            if (info->Relationship == RelationProcessorCore) {
+                coreCount++;
+            }
+            
+            offset += info->Size;
+        }
+    }
+    
+    free(buffer);
+    return coreCount;
+}
+
+static uint32 Exs_DetectCacheLineSize() {
+    DWORD bufferSize = 0;
+    GetLogicalProcessorInformation(nullptr, &bufferSize);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+        return 64;
+    }
+    
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION* buffer = 
+        (SYSTEM_LOGICAL_PROCESSOR_INFORMATION*)malloc(bufferSize);
+    if (!buffer) {
+        return 64;
+    }
+    
+    uint32 lineSize = 64;
+    if (GetLogicalProcessorInformation(buffer, &bufferSize)) {
+        DWORD count = bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+        for (DWORD i = 0; i < count; i++) {
+            if (buffer[i].Relationship == RelationCache && buffer[i].Cache.Level == 1) {
+                lineSize = buffer[i].Cache.LineSize;
+                break;
+            }
+        }
+    }
+    
+    free(buffer);
+    return lineSize;
+}
+
+// Same bitmap CPUInfo reports, so both agree on OS-enabled register state
+static void Exs_DetectSIMD(Exs_PlatformDescriptor& descriptor) {
+    using CPUInfo::Exs_CPUFeature;
+    const CPUInfo::Exs_CPUFeatureSet& features = CPUInfo::Exs_GetCPUFeatureSet();
+    
+    descriptor.hasSSE = features.has(Exs_CPUFeature::SSE);
+    descriptor.hasSSE2 = features.has(Exs_CPUFeature::SSE2);
+    descriptor.hasSSE42 = features.has(Exs_CPUFeature::SSE4_2);
+    descriptor.hasAVX = features.has(Exs_CPUFeature::AVX);
+    descriptor.hasAVX2 = features.has(Exs_CPUFeature::AVX2);
+    descriptor.hasAVX512F = features.has(Exs_CPUFeature::AVX512F);
+    descriptor.hasNEON = features.has(Exs_CPUFeature::ASIMD);
+}
+
+static Exs_PlatformDescriptor Exs_BuildPlatformDescriptor() {
+    Exs_PlatformDescriptor descriptor = {};
+    descriptor.endianness = Exs_CompileTimeEndianness();
+    
+    // Native architecture, which differs from the compile-time one under WOW64
+    SYSTEM_INFO sysInfo;
+    GetNativeSystemInfo(&sysInfo);
+    
+    switch (sysInfo.wProcessorArchitecture) {
+        case PROCESSOR_ARCHITECTURE_AMD64:
+            descriptor.architecture = Exs_Architecture::x64;
+            break;
+        case PROCESSOR_ARCHITECTURE_INTEL:
+            descriptor.architecture = Exs_Architecture::x86;
+            break;
+        case PROCESSOR_ARCHITECTURE_ARM:
+            descriptor.architecture = Exs_Architecture::ARM;
+            break;
+        case PROCESSOR_ARCHITECTURE_ARM64:
+            descriptor.architecture = Exs_Architecture::ARM64;
+            break;
+        default:
+            descriptor.architecture = Exs_CompileTimeArchitecture();
+    }
+    
+    descriptor.pageSize = sysInfo.dwPageSize;
+    descriptor.cacheLineSize = Exs_DetectCacheLineSize();
+    descriptor.logicalCoreCount = sysInfo.dwNumberOfProcessors;
+    descriptor.physicalCoreCount = Exs_CountPhysicalCores();
+    
+    Exs_DetectSIMD(descriptor);
+    return descriptor;
+}
+
+const Exs_PlatformDescriptor& Exs_GetPlatformDescriptor() {
+    static const Exs_PlatformDescriptor descriptor = Exs_BuildPlatformDescriptor();
+    return descriptor;
+}
+
+// Build the descriptor at load time so the first hot-path reader never pays for it
+static const Exs_PlatformDescriptor& s_loadTimeDescriptor = Exs_GetPlatformDescriptor();
+
 class Exs_PlatformWindows : public Exs_PlatformBase {
 private:
-    mutable std::string platformNameCache;
-    mutable std::string platformVersionCache;
-    mutable Exs_PlatformType platformTypeCache = Exs_PlatformType::Unknown;
+    // Computed once in the constructor and immutable afterwards
+    std::string platformNameCache;
+    std::string platformVersionCache;
+    Exs_PlatformType platformTypeCache = Exs_PlatformType::Unknown;
     
 public:
     Exs_PlatformWindows() {
         // Initialize platform detection
         detectPlatform();
+        platformNameCache = detectPlatformName();
+        platformVersionCache = detectPlatformVersion();
     }
     
     virtual ~Exs_PlatformWindows() = default;
     
     Exs_PlatformType getPlatformType() const override {
-        if (platformTypeCache == Exs_PlatformType::Unknown) {
-            detectPlatform();
-        }
         return platformTypeCache;
     }
     
     Exs_Architecture getArchitecture() const override {
-        SYSTEM_INFO sysInfo;
-        GetNativeSystemInfo(&sysInfo);
-        
-        switch (sysInfo.wProcessorArchitecture) {
-            case PROCESSOR_ARCHITECTURE_AMD64:
-                return Exs_Architecture::x64;
-            case PROCESSOR_ARCHITECTURE_INTEL:
-                return Exs_Architecture::x86;
-            case PROCESSOR_ARCHITECTURE_ARM:
-                return Exs_Architecture::ARM;
-            case PROCESSOR_ARCHITECTURE_ARM64:
-                return Exs_Architecture::ARM64;
-            default:
-                return Exs_Architecture::Unknown;
-        }
+        return Exs_GetPlatformDescriptor().architecture;
     }
     
     Exs_Endianness getEndianness() const override {
-        // Windows on x86/x64 is always little-endian
-        return Exs_Endianness::Little;
+        return Exs_GetPlatformDescriptor().endianness;
     }
     
     std::string getPlatformName() const override {
-        if (!platformNameCache.empty()) {
-            return platformNameCache;
-        }
-        
-        std::string name = "Windows";
-        
-        if (IsWindowsServer()) {
-            name += " Server";
-        } else if (IsWindowsVersionOrGreater(10, 0, 0)) {
-            name += " 10/11";
-        } else if (IsWindows8Point1OrGreater()) {
-            name += " 8.1";
-        } else if (IsWindows8OrGreater()) {
-            name += " 8";
-        } else if (IsWindows7OrGreater()) {
-            name += " 7";
-        } else if (IsWindowsVistaOrGreater()) {
-            name += " Vista";
-        } else if (IsWindowsXPOrGreater()) {
-            name += " XP";
-        }
-        
-        platformNameCache = name;
         return platformNameCache;
     }
     
     std::string getPlatformVersion() const override {
-        if (!platformVersionCache.empty()) {
-            return platformVersionCache;
-        }
-        
-        OSVERSIONINFOEXW osvi = { sizeof(osvi), 0, 0, 0, 0, {0}, 0, 0 };
-        DWORDLONG const dwlConditionMask = VerSetConditionMask(
-            VerSetConditionMask(
-                VerSetConditionMask(
-                    0, VER_MAJORVERSION, VER_GREATER_EQUAL),
-                VER_MINORVERSION, VER_GREATER_EQUAL),
-            VER_SERVICEPACKMAJOR, VER_GREATER_EQUAL);
-        
-        std::wstringstream versionStream;
-        
-        if (IsWindows10OrGreater()) {
-            versionStream << L"10.0";
-        } else if (IsWindows8Point1OrGreater()) {
-            versionStream << L"6.3";
-        } else if (IsWindows8OrGreater()) {
-            versionStream << L"6.2";
-        } else if (IsWindows7SP1OrGreater()) {
-            versionStream << L"6.1 SP1";
-        } else if (IsWindows7OrGreater()) {
-            versionStream << L"6.1";
-        } else if (IsWindowsVistaSP2OrGreater()) {
-            versionStream << L"6.0 SP2";
-        } else if (IsWindowsVistaSP1OrGreater()) {
-            versionStream << L"6.0 SP1";
-        } else if (IsWindowsVistaOrGreater()) {
-            versionStream << L"6.0";
-        } else if (IsWindowsXPSP3OrGreater()) {
-            versionStream << L"5.1 SP3";
-        } else if (IsWindowsXPSP2OrGreater()) {
-            versionStream << L"5.1 SP2";
-        } else if (IsWindowsXPSP1OrGreater()) {
-            versionStream << L"5.1 SP1";
-        } else if (IsWindowsXPOrGreater()) {
-            versionStream << L"5.1";
-        } else {
-            versionStream << L"Unknown";
-        }
-        
-        platformVersionCache = std::string(versionStream.str().begin(), versionStream.str().end());
         return platformVersionCache;
     }
     
@@ -146,35 +186,16 @@ public:
     }
     
     bool supportsSIMD() const override {
-        int cpuInfo[4] = {0};
-        __cpuid(cpuInfo, 1);
-        return (cpuInfo[3] & (1 << 25)) != 0; // Check SSE bit
+        const Exs_PlatformDescriptor& descriptor = Exs_GetPlatformDescriptor();
+        return descriptor.hasSSE || descriptor.hasNEON;
     }
     
     bool supportsAVX() const override {
-        int cpuInfo[4] = {0};
-        __cpuidex(cpuInfo, 1, 0);
-        
-        // Check OSXSAVE and AVX bits
-        bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
-        bool avx = (cpuInfo[2] & (1 << 28)) != 0;
-        
-        if (!osxsave || !avx) return false;
-        
-        // Check if OS supports AVX
-        uint32_t xcr0;
-        #if defined(_MSC_VER)
-        xcr0 = (uint32_t)_xgetbv(0);
-        #else
-        __asm__ ("xgetbv" : "=a" (xcr0) : "c" (0) : "%edx");
-        #endif
-        
-        return (xcr0 & 0x6) == 0x6;
+        return Exs_GetPlatformDescriptor().hasAVX;
     }
     
     bool supportsNEON() const override {
-        // NEON is ARM-specific, not supported on Windows x86/x64
-        return false;
+        return Exs_GetPlatformDescriptor().hasNEON;
     }
     
     std::string getHomeDirectory() const override {
@@ -243,54 +264,84 @@ public:
     }
     
     uint32 getMemoryPageSize() const override {
-        SYSTEM_INFO sysInfo;
-        GetSystemInfo(&sysInfo);
-        return sysInfo.dwPageSize;
+        return Exs_GetPlatformDescriptor().pageSize;
     }
     
     uint32 getPhysicalCoreCount() const override {
-        SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* buffer = nullptr;
-        DWORD bufferSize = 0;
+        return Exs_GetPlatformDescriptor().physicalCoreCount;
+    }
+    
+    uint32 getLogicalCoreCount() const override {
+        return Exs_GetPlatformDescriptor().logicalCoreCount;
+    }
+    
+private:
+    std::string detectPlatformName() const {
+        std::string name = "Windows";
         
-        GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &bufferSize);
-        if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
-            return 0;
+        if (IsWindowsServer()) {
+            name += " Server";
+        } else if (IsWindowsVersionOrGreater(10, 0, 0)) {
+            name += " 10/11";
+        } else if (IsWindows8Point1OrGreater()) {
+            name += " 8.1";
+        } else if (IsWindows8OrGreater()) {
+            name += " 8";
+        } else if (IsWindows7OrGreater()) {
+            name += " 7";
+        } else if (IsWindowsVistaOrGreater()) {
+            name += " Vista";
+        } else if (IsWindowsXPOrGreater()) {
+            name += " XP";
         }
         
-        buffer = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)malloc(bufferSize);
-        if (!buffer) {
-            return 0;
-        }
+        return name;
+    }
+    
+    std::string detectPlatformVersion() const {
+        OSVERSIONINFOEXW osvi = { sizeof(osvi), 0, 0, 0, 0, {0}, 0, 0 };
+        DWORDLONG const dwlConditionMask = VerSetConditionMask(
+            VerSetConditionMask(
+                VerSetConditionMask(
+                    0, VER_MAJORVERSION, VER_GREATER_EQUAL),
+                VER_MINORVERSION, VER_GREATER_EQUAL),
+            VER_SERVICEPACKMAJOR, VER_GREATER_EQUAL);
         
-        uint32 coreCount = 0;
-        if (GetLogicalProcessorInformationEx(RelationProcessorCore, buffer, &bufferSize)) {
-            BYTE* ptr = (BYTE*)buffer;
-            DWORD offset = 0;
-            
-            while (offset < bufferSize) {
-                SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info = 
-                    (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(ptr + offset);
-                
-                if (info->Relationship == RelationProcessorCore) {
-                    coreCount++;
-                }
-                
-                offset += info->Size;
-            }
+        std::wstringstream versionStream;
+        
+        if (IsWindows10OrGreater()) {
+            versionStream << L"10.0";
+        } else if (IsWindows8Point1OrGreater()) {
+            versionStream << L"6.3";
+        } else if (IsWindows8OrGreater()) {
+            versionStream << L"6.2";
+        } else if (IsWindows7SP1OrGreater()) {
+            versionStream << L"6.1 SP1";
+        } else if (IsWindows7OrGreater()) {
+            versionStream << L"6.1";
+        } else if (IsWindowsVistaSP2OrGreater()) {
+            versionStream << L"6.0 SP2";
+        } else if (IsWindowsVistaSP1OrGreater()) {
+            versionStream << L"6.0 SP1";
+        } else if (IsWindowsVistaOrGreater()) {
+            versionStream << L"6.0";
+        } else if (IsWindowsXPSP3OrGreater()) {
+            versionStream << L"5.1 SP3";
+        } else if (IsWindowsXPSP2OrGreater()) {
+            versionStream << L"5.1 SP2";
+        } else if (IsWindowsXPSP1OrGreater()) {
+            versionStream << L"5.1 SP1";
+        } else if (IsWindowsXPOrGreater()) {
+            versionStream << L"5.1";
+        } else {
+            versionStream << L"Unknown";
         }
         
-        free(buffer);
-        return coreCount;
+        std::wstring version = versionStream.str();
+        return std::string(version.begin(), version.end());
     }
     
-    uint32 getLogicalCoreCount() const override {
-        SYSTEM_INFO sysInfo;
-        GetSystemInfo(&sysInfo);
-        return sysInfo.dwNumberOfProcessors;
-    }
-    
-private:
-    void detectPlatform() const {
+    void detectPlatform() {
         if (IsWindowsServer()) {
             platformTypeCache = Exs_PlatformType::Windows;
         } else if (IsWindows10OrGreater()) {
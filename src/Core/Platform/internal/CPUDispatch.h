@@ -0,0 +1,141 @@
+// src/Core/Platform/internal/CPUDispatch.h
+#ifndef EXS_INTERNAL_CPU_DISPATCH_H
+#define EXS_INTERNAL_CPU_DISPATCH_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <atomic>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Instruction set a kernel variant is compiled for, ordered by preference
+enum class Exs_DispatchTarget {
+    Scalar = 0,
+    SSE2 = 1,
+    NEON = 2,
+    AVX2 = 3,
+    AVX512 = 4,
+    Count = 5
+};
+
+// Registered kernel, as reported by Exs_GetDispatchEntries()
+struct Exs_DispatchEntry {
+    std::string name;
+    Exs_DispatchTarget selectedTarget;
+    uint32 variantMask; // bit N set when a variant for target N is registered
+};
+
+// Whether the running CPU and OS can execute code built for the target.
+// Honours the EXS_DISPATCH_MAX environment variable (e.g. "sse2") as a cap;
+// the answer is computed on first use and cached for the process lifetime.
+bool Exs_IsDispatchTargetSupported(Exs_DispatchTarget target);
+
+// Best target supported by this machine
+Exs_DispatchTarget Exs_GetBestDispatchTarget();
+
+// Lower-case target name ("scalar", "sse2", "neon", "avx2", "avx512")
+const char* Exs_GetDispatchTargetName(Exs_DispatchTarget target);
+
+// Registry of dispatched kernels, for diagnostics
+void Exs_RegisterDispatchEntry(const char* name, const std::atomic<uint32>* selectedTarget,
+                               const std::atomic<uint32>* variantMask);
+std::vector<Exs_DispatchEntry> Exs_GetDispatchEntries();
+
+template <typename Signature>
+class Exs_CPUDispatch;
+
+// Function pointer resolved once to the best registered variant. Calls after
+// resolution are a single relaxed load and an indirect call, with no feature
+// checks on the call path. A Scalar variant must always be registered, and
+// instances are expected to have static storage duration.
+//
+//     static Exs_CPUDispatch<uint32(const uint8*, size_t)> s_checksum("checksum", {
+//         { Exs_DispatchTarget::Scalar, &checksumScalar },
+//         { Exs_DispatchTarget::AVX2, &checksumAVX2 } });
+//
+//     uint32 sum = s_checksum(data, size);
+template <typename R, typename... Args>
+class Exs_CPUDispatch<R(Args...)> {
+public:
+    using FunctionPointer = R (*)(Args...);
+
+    struct Variant {
+        Exs_DispatchTarget target;
+        FunctionPointer function;
+    };
+
+    Exs_CPUDispatch(const char* name, std::initializer_list<Variant> variants) {
+        for (auto& variant : variants) {
+            uint32 index = static_cast<uint32>(variant.target);
+            if (index < kTargetCount) {
+                table[index] = variant.function;
+            }
+        }
+        resolve();
+        Exs_RegisterDispatchEntry(name, &selected, &mask);
+    }
+
+    Exs_CPUDispatch(const Exs_CPUDispatch&) = delete;
+    Exs_CPUDispatch& operator=(const Exs_CPUDispatch&) = delete;
+
+    // Adds or replaces a variant after construction and re-resolves
+    void setVariant(Exs_DispatchTarget target, FunctionPointer function) {
+        uint32 index = static_cast<uint32>(target);
+        if (index < kTargetCount) {
+            table[index] = function;
+            resolve();
+        }
+    }
+
+    R operator()(Args... args) const {
+        return current.load(std::memory_order_relaxed)(args...);
+    }
+
+    FunctionPointer get() const {
+        return current.load(std::memory_order_relaxed);
+    }
+
+    Exs_DispatchTarget selectedTarget() const {
+        return static_cast<Exs_DispatchTarget>(selected.load(std::memory_order_relaxed));
+    }
+
+private:
+    static constexpr uint32 kTargetCount = static_cast<uint32>(Exs_DispatchTarget::Count);
+
+    void resolve() {
+        uint32 variantMask = 0;
+        FunctionPointer best = nullptr;
+        uint32 bestIndex = 0;
+
+        // Scan from the lowest target up so the last supported match wins
+        for (uint32 index = 0; index < kTargetCount; index++) {
+            if (table[index] == nullptr) {
+                continue;
+            }
+            variantMask |= 1u << index;
+            if (Exs_IsDispatchTargetSupported(static_cast<Exs_DispatchTarget>(index))) {
+                best = table[index];
+                bestIndex = index;
+            }
+        }
+
+        mask.store(variantMask, std::memory_order_relaxed);
+        selected.store(bestIndex, std::memory_order_relaxed);
+        current.store(best, std::memory_order_release);
+    }
+
+    FunctionPointer table[kTargetCount] = {};
+    std::atomic<FunctionPointer> current{nullptr};
+    std::atomic<uint32> selected{0};
+    std::atomic<uint32> mask{0};
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CPU_DISPATCH_H
@@ -0,0 +1,203 @@
+// src/Core/Platform/internal/CPUFeatureSet.h
+#ifndef EXS_INTERNAL_CPU_FEATURE_SET_H
+#define EXS_INTERNAL_CPU_FEATURE_SET_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <array>
+#include <string_view>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Every CPU feature we detect. Names below follow /proc/cpuinfo spelling
+// in upper case; keep both lists in the same order.
+enum class Exs_CPUFeature : uint32 {
+    // x86 leaf 1
+    MMX, SSE, SSE2, SSE3, PCLMULQDQ, SSSE3, FMA, CX16, SSE4_1, SSE4_2, MOVBE,
+    POPCNT, AES, XSAVE, OSXSAVE, AVX, F16C, RDRAND, HYPERVISOR, VMX,
+
+    // x86 leaf 7 subleaf 0
+    FSGSBASE, SGX, BMI1, HLE, AVX2, BMI2, ERMS, RTM, AVX512F, AVX512DQ, RDSEED,
+    ADX, AVX512IFMA, CLFLUSHOPT, CLWB, AVX512PF, AVX512ER, AVX512CD, SHA,
+    AVX512BW, AVX512VL, AVX512VBMI, WAITPKG, AVX512_VBMI2, GFNI, VAES,
+    VPCLMULQDQ, AVX512_VNNI, AVX512_BITALG, AVX512_VPOPCNTDQ, RDPID, MOVDIRI,
+    MOVDIR64B, AVX512_4VNNIW, AVX512_4FMAPS, FSRM, AVX512_VP2INTERSECT,
+    SERIALIZE, HYBRID, TSXLDTRK, AMX_BF16, AVX512_FP16, AMX_TILE, AMX_INT8,
+
+    // x86 leaf 7 subleaf 1
+    AVX_VNNI, AVX512_BF16,
+
+    // x86 extended leaves
+    LAHF_LM, SVM, ABM, SSE4A, PREFETCHW, XOP, FMA4, TBM, NX, PDPE1GB, RDTSCP,
+    LM, INVARIANT_TSC,
+
+    // ARM (AT_HWCAP / AT_HWCAP2); AES is shared with x86
+    FP, ASIMD, PMULL, SHA1, SHA2, CRC32, ATOMICS, FPHP, ASIMDHP, ASIMDDP, SHA3,
+    SHA512, SM3, SM4, ASIMDFHM, SVE, SVE2, I8MM, BF16, MTE,
+
+    Count
+};
+
+constexpr uint32 kExs_CPUFeatureCount = static_cast<uint32>(Exs_CPUFeature::Count);
+
+inline constexpr std::array<std::string_view, kExs_CPUFeatureCount> kExs_CPUFeatureNames = {
+    "MMX", "SSE", "SSE2", "SSE3", "PCLMULQDQ", "SSSE3", "FMA", "CX16", "SSE4_1", "SSE4_2", "MOVBE",
+    "POPCNT", "AES", "XSAVE", "OSXSAVE", "AVX", "F16C", "RDRAND", "HYPERVISOR", "VMX",
+
+    "FSGSBASE", "SGX", "BMI1", "HLE", "AVX2", "BMI2", "ERMS", "RTM", "AVX512F", "AVX512DQ", "RDSEED",
+    "ADX", "AVX512IFMA", "CLFLUSHOPT", "CLWB", "AVX512PF", "AVX512ER", "AVX512CD", "SHA",
+    "AVX512BW", "AVX512VL", "AVX512VBMI", "WAITPKG", "AVX512_VBMI2", "GFNI", "VAES",
+    "VPCLMULQDQ", "AVX512_VNNI", "AVX512_BITALG", "AVX512_VPOPCNTDQ", "RDPID", "MOVDIRI",
+    "MOVDIR64B", "AVX512_4VNNIW", "AVX512_4FMAPS", "FSRM", "AVX512_VP2INTERSECT",
+    "SERIALIZE", "HYBRID", "TSXLDTRK", "AMX_BF16", "AVX512_FP16", "AMX_TILE", "AMX_INT8",
+
+    "AVX_VNNI", "AVX512_BF16",
+
+    "LAHF_LM", "SVM", "ABM", "SSE4A", "PREFETCHW", "XOP", "FMA4", "TBM", "NX", "PDPE1GB", "RDTSCP",
+    "LM", "INVARIANT_TSC",
+
+    "FP", "ASIMD", "PMULL", "SHA1", "SHA2", "CRC32", "ATOMICS", "FPHP", "ASIMDHP", "ASIMDDP", "SHA3",
+    "SHA512", "SM3", "SM4", "ASIMDFHM", "SVE", "SVE2", "I8MM", "BF16", "MTE"
+};
+
+static_assert(kExs_CPUFeatureNames.back() == "MTE", "feature names out of sync with Exs_CPUFeature");
+
+// Extra spellings accepted by lookups, including the names supportsFeature() used before
+struct Exs_CPUFeatureAlias {
+    std::string_view name;
+    Exs_CPUFeature feature;
+};
+
+inline constexpr Exs_CPUFeatureAlias kExs_CPUFeatureAliases[] = {
+    { "SSE4.1", Exs_CPUFeature::SSE4_1 },
+    { "SSE4.2", Exs_CPUFeature::SSE4_2 },
+    { "AVX512", Exs_CPUFeature::AVX512F },
+    { "NEON", Exs_CPUFeature::ASIMD },
+    { "SHA_NI", Exs_CPUFeature::SHA },
+    { "LZCNT", Exs_CPUFeature::ABM },
+    { "3DNOWPREFETCH", Exs_CPUFeature::PREFETCHW },
+    { "PCLMUL", Exs_CPUFeature::PCLMULQDQ },
+    { "CONSTANT_TSC", Exs_CPUFeature::INVARIANT_TSC }
+};
+
+constexpr uint32 kExs_CPUFeatureNameCount =
+    kExs_CPUFeatureCount + static_cast<uint32>(sizeof(kExs_CPUFeatureAliases) / sizeof(kExs_CPUFeatureAliases[0]));
+
+// Detected features, one bit per Exs_CPUFeature
+class Exs_CPUFeatureSet {
+public:
+    constexpr bool has(Exs_CPUFeature feature) const {
+        uint32 index = static_cast<uint32>(feature);
+        return (bits[index / 64] >> (index % 64)) & 1;
+    }
+
+    constexpr void set(Exs_CPUFeature feature, bool value = true) {
+        uint32 index = static_cast<uint32>(feature);
+        if (value) {
+            bits[index / 64] |= 1ULL << (index % 64);
+        } else {
+            bits[index / 64] &= ~(1ULL << (index % 64));
+        }
+    }
+
+private:
+    uint64 bits[(kExs_CPUFeatureCount + 63) / 64] = {};
+};
+
+constexpr std::string_view Exs_GetCPUFeatureName(Exs_CPUFeature feature) {
+    return kExs_CPUFeatureNames[static_cast<uint32>(feature)];
+}
+
+// Case-insensitive FNV-1a
+constexpr uint32 Exs_HashCPUFeatureName(std::string_view name, uint32 seed) {
+    uint32 hash = 2166136261u ^ seed;
+    for (char c : name) {
+        if (c >= 'a' && c <= 'z') {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+        hash ^= static_cast<uint8>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+constexpr bool Exs_CPUFeatureNamesEqual(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        char ca = a[i] >= 'a' && a[i] <= 'z' ? static_cast<char>(a[i] - 'a' + 'A') : a[i];
+        if (ca != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Perfect hash over canonical names and aliases, built at compile time:
+// the seed is the first one for which no two names share a slot
+constexpr uint32 kExs_CPUFeatureHashSlots = 4096;
+
+struct Exs_CPUFeatureHashTable {
+    uint32 seed;
+    uint8 slots[kExs_CPUFeatureHashSlots]; // name index + 1, 0 = empty
+};
+
+constexpr std::string_view Exs_GetCPUFeatureLookupName(uint32 index) {
+    return index < kExs_CPUFeatureCount ? kExs_CPUFeatureNames[index]
+                                        : kExs_CPUFeatureAliases[index - kExs_CPUFeatureCount].name;
+}
+
+constexpr Exs_CPUFeature Exs_GetCPUFeatureLookupTarget(uint32 index) {
+    return index < kExs_CPUFeatureCount ? static_cast<Exs_CPUFeature>(index)
+                                        : kExs_CPUFeatureAliases[index - kExs_CPUFeatureCount].feature;
+}
+
+constexpr Exs_CPUFeatureHashTable Exs_BuildCPUFeatureHashTable() {
+    static_assert(kExs_CPUFeatureNameCount < 255, "slot indices are stored in a uint8");
+
+    for (uint32 seed = 0;; seed++) {
+        Exs_CPUFeatureHashTable table = {};
+        table.seed = seed;
+
+        bool collision = false;
+        for (uint32 index = 0; index < kExs_CPUFeatureNameCount && !collision; index++) {
+            uint32 slot = Exs_HashCPUFeatureName(Exs_GetCPUFeatureLookupName(index), seed) % kExs_CPUFeatureHashSlots;
+            collision = table.slots[slot] != 0;
+            table.slots[slot] = static_cast<uint8>(index + 1);
+        }
+
+        if (!collision) {
+            return table;
+        }
+    }
+}
+
+inline constexpr Exs_CPUFeatureHashTable kExs_CPUFeatureHashTable = Exs_BuildCPUFeatureHashTable();
+
+// Resolves a feature name (any case, canonical or alias) without allocating
+constexpr bool Exs_FindCPUFeature(std::string_view name, Exs_CPUFeature& feature) {
+    uint32 slot = Exs_HashCPUFeatureName(name, kExs_CPUFeatureHashTable.seed) % kExs_CPUFeatureHashSlots;
+    uint32 entry = kExs_CPUFeatureHashTable.slots[slot];
+    if (entry == 0 || !Exs_CPUFeatureNamesEqual(name, Exs_GetCPUFeatureLookupName(entry - 1))) {
+        return false;
+    }
+    feature = Exs_GetCPUFeatureLookupTarget(entry - 1);
+    return true;
+}
+
+// Features of the running machine, detected once (platform specific)
+const Exs_CPUFeatureSet& Exs_GetCPUFeatureSet();
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+// Sets the x86 features reported by cpuid, cleared where XCR0 shows the
+// OS does not save the register state they need
+void Exs_DetectX86CPUFeatures(Exs_CPUFeatureSet& set);
+#endif
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CPU_FEATURE_SET_H
@@ -0,0 +1,54 @@
+// src/Core/Platform/internal/CPUID.h
+#ifndef EXS_INTERNAL_CPUID_H
+#define EXS_INTERNAL_CPUID_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+// Executes cpuid; registers receives EAX, EBX, ECX, EDX in that order
+inline void Exs_ReadCPUID(uint32 leaf, uint32 subleaf, uint32 registers[4]) {
+#if defined(_M_X64) || defined(_M_IX86)
+    int values[4] = {0};
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; i++) {
+        registers[i] = static_cast<uint32>(values[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+// Highest leaf of the basic (0) or extended (0x80000000) range
+inline uint32 Exs_GetMaxCPUIDLeaf(uint32 base) {
+    uint32 registers[4] = {0};
+    Exs_ReadCPUID(base, 0, registers);
+    return registers[0];
+}
+
+// Register state the OS saves on context switch; only valid with OSXSAVE
+inline uint64 Exs_ReadXCR0() {
+#if defined(_M_X64) || defined(_M_IX86)
+    return _xgetbv(0);
+#else
+    uint32 eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CPUID_H
@@ -20,6 +20,13 @@ struct Exs_CPUCacheInfo {
     std::string type; // "Data", "Instruction", "Unified"
 };
 
+// Core class on hybrid parts (P-core/E-core, big.LITTLE)
+enum class Exs_CPUCoreType {
+    Unknown = 0,
+    Performance = 1, // also every core of a non-hybrid CPU
+    Efficiency = 2
+};
+
 // CPU Core information
 struct Exs_CPUCoreInfo {
     uint32 coreId;
@@ -31,6 +38,8 @@ struct Exs_CPUCoreInfo {
     uint32 temperatureCelsius;
     double utilizationPercentage;
     bool isHyperThread;
+    Exs_CPUCoreType coreType;
+    uint32 relativeCapacity; // 1024 = the fastest core of the machine
 };
 
 // CPU Vendor enumeration
@@ -142,8 +151,10 @@ public:
     virtual uint64 getBranchMisses() const = 0;
     virtual uint64 getCycles() const = 0;
     
-    // CPU topology
+    // CPU topology: readable summary, and the full tree as compact JSON
+    // (empty where the platform does not build one)
     virtual std::string getTopologyString() const = 0;
+    virtual std::string getTopologyJSON() const = 0;
     
     // CPU capabilities check
     virtual bool supportsVirtualization() const = 0;
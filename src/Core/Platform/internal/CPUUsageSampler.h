@@ -0,0 +1,90 @@
+// src/Core/Platform/internal/CPUUsageSampler.h
+#ifndef EXS_INTERNAL_CPU_USAGE_SAMPLER_H
+#define EXS_INTERNAL_CPU_USAGE_SAMPLER_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Share of one interval spent in each state, in percent
+struct Exs_CPUTimeBreakdown {
+    double user;    // includes nice
+    double system;
+    double idle;
+    double iowait;
+    double irq;     // hard and soft interrupts
+    double steal;
+    double busy;    // 100 - idle - iowait
+    bool online;    // present in both samples of the interval
+};
+
+// Utilization of every CPU over the last interval
+struct Exs_CPUUsageSnapshot {
+    uint64 sequence;      // increments with every published sample
+    uint64 intervalNs;    // time between the two samples
+    Exs_CPUTimeBreakdown total;
+    std::vector<Exs_CPUTimeBreakdown> cpus; // indexed by logical CPU id
+};
+
+struct Exs_CPUUsageBuffer;
+
+// Reads /proc/stat with one pread() of a kept-open descriptor per sample and
+// computes deltas for all CPUs in the same pass. The result is published in
+// one of two buffers; readers never block and always get one whole sample.
+class Exs_CPUUsageSampler {
+public:
+    Exs_CPUUsageSampler();
+    ~Exs_CPUUsageSampler();
+
+    Exs_CPUUsageSampler(const Exs_CPUUsageSampler&) = delete;
+    Exs_CPUUsageSampler& operator=(const Exs_CPUUsageSampler&) = delete;
+
+    // Takes a sample and publishes the interval since the previous one.
+    // When the previous sample is younger than minIntervalMs the published
+    // interval is kept instead, since /proc/stat advances in 10ms ticks and
+    // back-to-back samples read as idle; if nothing was published yet the
+    // call waits out the rest of the interval. Concurrent callers are
+    // serialized.
+    bool sample(uint32 minIntervalMs = 0);
+
+    // Latest published interval; false before the second sample
+    bool getSnapshot(Exs_CPUUsageSnapshot& snapshot) const;
+
+    uint32 getCPUCapacity() const;
+
+private:
+    bool readAndPublish();
+    void publish(const Exs_CPUTimeBreakdown& total, const std::vector<Exs_CPUTimeBreakdown>& cpus,
+                 uint64 intervalNs);
+
+    int fd;
+    uint32 cpuCapacity;
+
+    // Sampling side, guarded by sampleMutex
+    std::mutex sampleMutex;
+    std::vector<char> readBuffer;
+    std::vector<uint64> previousTimes; // 8 jiffy fields per slot, slot 0 = aggregate
+    std::vector<uint64> currentTimes;
+    std::vector<bool> previousSeen;
+    std::vector<bool> currentSeen;
+    uint64 previousTimestampNs;
+    bool havePrevious;
+    std::vector<Exs_CPUTimeBreakdown> scratch;
+
+    // Publishing side
+    std::unique_ptr<Exs_CPUUsageBuffer> buffers[2];
+    std::atomic<uint32> published{0};
+    std::atomic<uint64> sequence{0};
+};
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CPU_USAGE_SAMPLER_H
@@ -0,0 +1,55 @@
+// src/Core/Platform/internal/CacheTopology.h
+#ifndef EXS_INTERNAL_CACHE_TOPOLOGY_H
+#define EXS_INTERNAL_CACHE_TOPOLOGY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// One physical cache instance and the logical CPUs that share it
+struct Exs_CacheDomain {
+    uint32 index;         // position in Exs_GetCacheDomains()
+    uint32 instanceId;    // cache/indexN/id, or index when not reported
+    uint32 level;
+    std::string type;     // "Data", "Instruction", "Unified"
+    uint32 sizeKB;
+    uint32 lineSize;
+    uint32 associativity;
+    std::vector<uint32> cpus; // online CPUs sharing this instance, ascending
+};
+
+// A slice of [begin, end) assigned to one cache domain
+struct Exs_CacheWorkPartition {
+    uint32 domainIndex;
+    std::vector<uint32> cpus; // CPUs of the domain this process may run on
+    uint64 begin;
+    uint64 end;
+};
+
+// Every cache instance of the machine, read once (platform specific)
+const std::vector<Exs_CacheDomain>& Exs_GetCacheDomains();
+
+// Data and unified instances of one level; level 0 = the last level
+std::vector<const Exs_CacheDomain*> Exs_GetCacheDomainsAtLevel(uint32 level);
+
+// Instance of a data or unified cache level that holds cpu, or nullptr
+const Exs_CacheDomain* Exs_GetCacheDomainOfCPU(uint32 cpu, uint32 level);
+
+// Splits [begin, end) across the domains of a level in proportion to how many
+// allowed CPUs each one has, so that every slice can stay inside one L3/CCX.
+// Domains without allowed CPUs are skipped; an empty range gives every
+// partition the empty slice [begin, begin).
+std::vector<Exs_CacheWorkPartition> Exs_PartitionWorkByCache(uint64 begin, uint64 end, uint32 level = 0);
+
+// Restricts the calling thread to the CPUs of one cache instance
+bool Exs_PinCurrentThreadToCacheDomain(const Exs_CacheDomain& domain);
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CACHE_TOPOLOGY_H
@@ -0,0 +1,87 @@
+// src/Core/Platform/internal/CoreFrequency.h
+#ifndef EXS_INTERNAL_CORE_FREQUENCY_H
+#define EXS_INTERNAL_CORE_FREQUENCY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <mutex>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Where effective frequencies come from
+enum class Exs_FrequencySource {
+    None = 0,
+    MSR = 1,     // IA32_APERF/IA32_MPERF through /dev/cpu/N/msr
+    PerfMSR = 2, // aperf/mperf events of the perf "msr" PMU
+    Cpufreq = 3  // scaling_cur_freq, the frequency last requested by the governor
+};
+
+// Effective frequency of one logical CPU over the last interval
+struct Exs_CoreFrequencySample {
+    uint32 cpu;
+    uint32 effectiveMHz; // average while not halted; 0 when unknown
+    bool valid;
+};
+
+// APERF/MPERF readings of one CPU carried between sweeps
+struct Exs_FrequencyCounterState {
+    bool havePrevious = false;
+    uint64 lastAPERF = 0;
+    uint64 lastMPERF = 0;
+    uint32 lastEffectiveMHz = 0; // result of the last interval MPERF advanced in
+};
+
+// Feeds one reading and returns base * dAPERF / dMPERF since the previous
+// one, 0 when unknown. A CPU halted for the whole interval (MPERF did not
+// move) repeats its last frequency and keeps its baseline, so the next
+// interval covers this one too.
+uint32 Exs_UpdateFrequencyCounter(Exs_FrequencyCounterState& state, uint64 aperf, uint64 mperf,
+                                  uint32 baseFrequencyMHz);
+
+struct Exs_CoreFrequencyCounter;
+
+// Samples all CPUs in one sweep over descriptors opened at construction.
+// With APERF/MPERF the result is base frequency * dAPERF / dMPERF between
+// two sweeps, so turbo and throttling show up; the cpufreq fallback only
+// reports the governor's request.
+class Exs_CoreFrequencySampler {
+public:
+    Exs_CoreFrequencySampler(const std::vector<uint32>& cpus, uint32 baseFrequencyMHz);
+    ~Exs_CoreFrequencySampler();
+
+    Exs_CoreFrequencySampler(const Exs_CoreFrequencySampler&) = delete;
+    Exs_CoreFrequencySampler& operator=(const Exs_CoreFrequencySampler&) = delete;
+
+    Exs_FrequencySource getSource() const;
+
+    // Reads every CPU once. Counter sources need a previous sweep at least
+    // minIntervalMs old: a call that comes sooner returns the last result,
+    // and one with no result yet waits out the rest of the interval. A CPU
+    // that stayed idle (MPERF did not move) keeps its last frequency and
+    // its interval extends into the next sweep.
+    bool sample(std::vector<Exs_CoreFrequencySample>& samples, uint32 minIntervalMs = 10);
+
+private:
+    bool openMSR();
+    bool openPerfMSR();
+    bool openCpufreq();
+    void sweep();
+
+    std::mutex mutex;
+    std::vector<uint32> cpus;
+    uint32 baseFrequencyMHz;
+    Exs_FrequencySource source;
+    bool havePrevious;
+    bool haveResult;    // a sweep with a previous one before it
+    uint64 lastSweepNs;
+    std::vector<Exs_CoreFrequencyCounter> counters; // one per CPU, same order
+    std::vector<Exs_CoreFrequencySample> latest;
+};
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CORE_FREQUENCY_H
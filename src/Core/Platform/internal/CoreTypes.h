@@ -0,0 +1,51 @@
+// src/Core/Platform/internal/CoreTypes.h
+#ifndef EXS_INTERNAL_CORE_TYPES_H
+#define EXS_INTERNAL_CORE_TYPES_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include "CPUInfoBase.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Where the core classification comes from
+enum class Exs_CoreTypeSource {
+    None = 0,      // homogeneous machine, or nothing reported
+    HybridPMU = 1, // /sys/devices/cpu_core/cpus and cpu_atom/cpus (Intel hybrid)
+    CPUID = 2,     // leaf 0x1A core type, executed on every CPU
+    Capacity = 3   // cpu_capacity of the scheduler (ARM big.LITTLE/DynamIQ)
+};
+
+// Class and relative speed of one logical CPU
+struct Exs_CoreTypeInfo {
+    uint32 cpu;
+    Exs_CPUCoreType type;
+    uint32 capacity; // 1024 = the fastest core; scaled by maximum frequency when known
+};
+
+// Every online CPU in ascending order, classified once (platform specific).
+// Without a hybrid signal all CPUs are Performance with capacity 1024.
+const std::vector<Exs_CoreTypeInfo>& Exs_GetCoreTypes();
+
+Exs_CoreTypeSource Exs_GetCoreTypeSource();
+
+// True when both classes are present
+bool Exs_IsHybridCPU();
+
+// Entry of one CPU, or nullptr when it is not online
+const Exs_CoreTypeInfo* Exs_GetCoreTypeOfCPU(uint32 cpu);
+
+// Online CPUs of one class, ascending; Efficiency is empty on non-hybrid parts
+std::vector<uint32> Exs_GetCPUsOfCoreType(Exs_CPUCoreType type);
+
+// Restricts the calling thread to the CPUs of one class, e.g. to keep
+// latency-sensitive work off E-cores
+bool Exs_PinCurrentThreadToCoreType(Exs_CPUCoreType type);
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_CORE_TYPES_H
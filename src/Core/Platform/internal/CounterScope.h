@@ -0,0 +1,61 @@
+// src/Core/Platform/internal/CounterScope.h
+#ifndef EXS_INTERNAL_COUNTER_SCOPE_H
+#define EXS_INTERNAL_COUNTER_SCOPE_H
+
+#include "PerfCounters.h"
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Maximum number of distinct region names per thread
+constexpr uint32 kExs_MaxCounterRegionsPerThread = 256;
+
+// Totals of one region name across all threads
+struct Exs_CounterRegionStats {
+    std::string name;
+    uint64 calls;
+    uint64 values[kExs_PerfCounterEventCount]; // indexed by Exs_PerfCounterEvent
+
+    uint64 get(Exs_PerfCounterEvent event) const {
+        return values[static_cast<uint32>(event)];
+    }
+};
+
+struct Exs_CounterThreadTable;
+
+// Counts hardware events between construction and destruction and adds
+// them to the calling thread's table under name. The name must outlive the
+// process (a string literal): regions are keyed by pointer on the hot path
+// and merged by content only when collected. Nested regions are inclusive.
+class Exs_CounterScope {
+public:
+    explicit Exs_CounterScope(const char* name);
+    ~Exs_CounterScope();
+
+    Exs_CounterScope(const Exs_CounterScope&) = delete;
+    Exs_CounterScope& operator=(const Exs_CounterScope&) = delete;
+
+private:
+    const char* name;
+    Exs_CounterThreadTable* table;
+    uint64 start[kExs_PerfCounterEventCount];
+};
+
+// Adds one call with the given event deltas to the calling thread's table
+// under name, as a scope does when it ends; same lifetime rule for name
+void Exs_RecordCounterRegion(const char* name, const uint64 deltas[kExs_PerfCounterEventCount]);
+
+// Merges the tables of all live and exited threads, sorted by cycles
+std::vector<Exs_CounterRegionStats> Exs_CollectCounterRegions();
+
+// Clears every table; regions running right now still add their delta
+void Exs_ResetCounterRegions();
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_COUNTER_SCOPE_H
@@ -0,0 +1,71 @@
+// src/Core/Platform/internal/HugePageMemory.h
+#ifndef EXS_INTERNAL_HUGE_PAGE_MEMORY_H
+#define EXS_INTERNAL_HUGE_PAGE_MEMORY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// Explicit huge page pool of one page size
+struct Exs_HugePagePoolInfo {
+    uint64 pageSizeBytes;
+    uint64 totalPages;
+    uint64 freePages;
+    uint64 reservedPages;
+    uint64 surplusPages;
+};
+
+// Transparent huge page policy of the kernel
+enum class Exs_TransparentHugePageMode {
+    Unknown = 0,
+    Always = 1,
+    Madvise = 2,
+    Never = 3
+};
+
+// How a large region is backed
+enum class Exs_LargeRegionBacking {
+    None = 0,            // allocation failed
+    BasePages = 1,       // regular pages only
+    TransparentHuge = 2, // THP requested with madvise(MADV_HUGEPAGE)
+    ExplicitHuge = 3     // hugetlb pool pages (MAP_HUGETLB)
+};
+
+// A large mapping returned by Exs_AllocateLargeRegion
+struct Exs_LargeRegion {
+    void* address;
+    uint64 size;          // mapped size, rounded up to the page size used
+    uint64 pageSizeBytes; // huge page size requested, or the base page size
+    Exs_LargeRegionBacking backing;
+};
+
+// Huge page residency of a region, as reported by the kernel
+struct Exs_LargeRegionResidency {
+    uint64 residentBytes;
+    uint64 hugePageBytes;    // AnonHugePages + hugetlb pages
+    double hugePageFraction; // hugePageBytes / residentBytes
+};
+
+// Pools under /sys/kernel/mm/hugepages, ordered by page size
+std::vector<Exs_HugePagePoolInfo> Exs_GetHugePagePools();
+
+Exs_TransparentHugePageMode Exs_GetTransparentHugePageMode();
+
+// Reserves size bytes backed by huge pages when possible. Tries an explicit
+// hugetlb mapping of preferredPageSize (0 = smallest pool with enough free
+// pages), then a THP-aligned anonymous mapping, then base pages.
+Exs_LargeRegion Exs_AllocateLargeRegion(uint64 size, uint64 preferredPageSize = 0);
+void Exs_FreeLargeRegion(Exs_LargeRegion& region);
+
+// Reads the region's entry from /proc/self/smaps. Pages are only counted
+// once touched, so query after the region has been populated.
+Exs_LargeRegionResidency Exs_GetLargeRegionResidency(const Exs_LargeRegion& region);
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_HUGE_PAGE_MEMORY_H
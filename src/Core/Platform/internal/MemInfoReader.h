@@ -0,0 +1,89 @@
+// src/Core/Platform/internal/MemInfoReader.h
+#ifndef EXS_INTERNAL_MEM_INFO_READER_H
+#define EXS_INTERNAL_MEM_INFO_READER_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <mutex>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// /proc/meminfo keys we keep; keep kExs_MemInfoKeys in the same order
+enum class Exs_MemInfoField : uint32 {
+    MemTotal, MemFree, MemAvailable, Buffers, Cached, SwapCached, Active, Inactive,
+    Unevictable, Mlocked, SwapTotal, SwapFree, Dirty, Writeback, AnonPages, Mapped,
+    Shmem, KReclaimable, Slab, SReclaimable, SUnreclaim, KernelStack, PageTables,
+    CommitLimit, Committed_AS, AnonHugePages, ShmemHugePages, FileHugePages,
+    HugePages_Total, HugePages_Free, HugePages_Rsvd, HugePages_Surp, Hugepagesize,
+    Hugetlb, MemUsed, // MemUsed: per-node files only
+
+    Count
+};
+
+constexpr uint32 kExs_MemInfoFieldCount = static_cast<uint32>(Exs_MemInfoField::Count);
+
+// One parse of a meminfo file. kB values are stored in bytes; HugePages_*
+// are page counts.
+struct Exs_MemInfoValues {
+    uint64 values[kExs_MemInfoFieldCount];
+    uint64 present; // bit per field
+
+    uint64 get(Exs_MemInfoField field) const {
+        return values[static_cast<uint32>(field)];
+    }
+
+    bool has(Exs_MemInfoField field) const {
+        return (present >> static_cast<uint32>(field)) & 1;
+    }
+};
+
+static_assert(kExs_MemInfoFieldCount <= 64, "presence bits are stored in a uint64");
+
+// Parses /proc/meminfo or a /sys/devices/system/node/nodeN/meminfo buffer
+// ("Node N " prefixes are skipped) without allocating. lineHints maps line
+// numbers to fields seen there last time, so a stable layout costs one
+// compare per line; pass nullptr to always search the key table.
+bool Exs_ParseMemInfo(const char* buffer, size_t length, Exs_MemInfoValues& values,
+                      uint8* lineHints = nullptr, uint32 lineHintCount = 0);
+
+constexpr uint32 kExs_MemInfoDefaultMaxAgeMs = 100;
+
+// Kept-open meminfo file re-read with one pread() once the cached values
+// are older than the staleness window. Every getter of a dashboard refresh
+// then shares one syscall.
+class Exs_MemInfoReader {
+public:
+    explicit Exs_MemInfoReader(const char* path = "/proc/meminfo", uint32 maxAgeMs = kExs_MemInfoDefaultMaxAgeMs);
+    ~Exs_MemInfoReader();
+
+    Exs_MemInfoReader(const Exs_MemInfoReader&) = delete;
+    Exs_MemInfoReader& operator=(const Exs_MemInfoReader&) = delete;
+
+    bool isOpen() const;
+
+    // Cached values, re-read when older than the window; 0 = always re-read
+    bool read(Exs_MemInfoValues& values);
+
+    void setMaxAge(uint32 maxAgeMs);
+    uint32 getMaxAge() const;
+
+private:
+    static constexpr uint32 kBufferSize = 8192;
+    static constexpr uint32 kLineHintCount = 96;
+
+    mutable std::mutex mutex;
+    int fd;
+    uint32 maxAgeMs;
+    uint64 lastReadNs;
+    bool valid;
+    Exs_MemInfoValues cached;
+    uint8 lineHints[kLineHintCount];
+    char buffer[kBufferSize];
+};
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_MEM_INFO_READER_H
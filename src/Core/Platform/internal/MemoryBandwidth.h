@@ -0,0 +1,72 @@
+// src/Core/Platform/internal/MemoryBandwidth.h
+#ifndef EXS_INTERNAL_MEMORY_BANDWIDTH_H
+#define EXS_INTERNAL_MEMORY_BANDWIDTH_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include "CPUDispatch.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// The four STREAM kernels; bytes moved per element are counted as STREAM does
+enum class Exs_StreamKernel : uint32 {
+    Copy = 0,  // a = b          16 bytes
+    Scale = 1, // a = s * b      16 bytes
+    Add = 2,   // a = b + c      24 bytes
+    Triad = 3, // a = b + s * c  24 bytes
+    Count = 4
+};
+
+constexpr uint32 kExs_StreamKernelCount = static_cast<uint32>(Exs_StreamKernel::Count);
+
+// Bandwidth of one kernel over the timed repetitions (the first is warm-up)
+struct Exs_StreamKernelResult {
+    double bestGBps;   // STREAM's headline number: the fastest repetition
+    double meanGBps;
+    double stddevGBps;
+    double bestSeconds;
+};
+
+struct Exs_StreamRunResult {
+    uint32 node;    // NUMA node, or kExs_StreamAllNodes for the whole system
+    uint32 threads; // one pinned thread per listed CPU
+    std::vector<uint32> cpus;
+    Exs_StreamKernelResult kernels[kExs_StreamKernelCount];
+
+    const Exs_StreamKernelResult& get(Exs_StreamKernel kernel) const {
+        return kernels[static_cast<uint32>(kernel)];
+    }
+};
+
+constexpr uint32 kExs_StreamAllNodes = 0xFFFFFFFF;
+
+struct Exs_StreamOptions {
+    uint64 arrayBytes = 0;      // per array; 0 = 4x the last-level cache total, capped by free memory
+    uint32 repetitions = 10;    // timed runs per kernel, plus one warm-up
+    bool nonTemporalStores = true;
+    bool perNode = true;        // one run per NUMA node with CPUs, besides the system run
+    uint32 threadsPerNode = 0;  // 0 = one per physical core
+};
+
+struct Exs_StreamReport {
+    Exs_StreamRunResult system;
+    std::vector<Exs_StreamRunResult> nodes;
+    Platform::Exs_DispatchTarget target; // kernel variant that ran
+    uint64 arrayBytes;
+    uint32 repetitions;
+    bool nonTemporalStores;
+};
+
+// STREAM-style measurement: three arrays well beyond the caches, each thread
+// pinned to one core and first-touching its own slice so pages are local,
+// and every repetition timed between two barriers. Takes seconds; callers
+// should cache the report (platform specific).
+Exs_StreamReport Exs_MeasureMemoryBandwidth(const Exs_StreamOptions& options = Exs_StreamOptions());
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_MEMORY_BANDWIDTH_H
@@ -0,0 +1,51 @@
+// src/Core/Platform/internal/MemoryFragmentation.h
+#ifndef EXS_INTERNAL_MEMORY_FRAGMENTATION_H
+#define EXS_INTERNAL_MEMORY_FRAGMENTATION_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// Free lists of one zone (or of all zones), from /proc/buddyinfo. Indices
+// follow the kernel's: unusable 0.0-1.0; extfrag -1.0 when an allocation of
+// the order would succeed, else toward 0.0 for lack of memory and toward
+// 1.0 for fragmentation.
+struct Exs_BuddyZoneInfo {
+    uint32 node;
+    std::string zone;                // "DMA", "DMA32", "Normal", "Movable"
+    std::vector<uint64> freeBlocks;  // free blocks of each order
+    uint64 freePages;
+    uint64 largestFreeBlockBytes;    // 0 when the zone has nothing free
+    uint64 hugePageBlocks;           // free huge-page-sized blocks
+    double unusableIndex;            // free memory not in huge-page-sized blocks
+    double extfragIndex;             // for one huge-page-sized allocation
+    bool extfragFromKernel;          // read from debugfs, not computed here
+};
+
+struct Exs_FragmentationReport {
+    uint64 pageSizeBytes;
+    uint32 hugePageOrder;            // order of a PMD-sized huge page
+    std::vector<Exs_BuddyZoneInfo> zones;
+    Exs_BuddyZoneInfo total;         // all zones summed; node and zone unset
+};
+
+// Parses /proc/buddyinfo for each zone and order. The kernel's
+// extfrag_index from /sys/kernel/debug/extfrag is used where readable
+// (normally root only); otherwise it is computed with the same formula.
+bool Exs_GetFragmentationReport(Exs_FragmentationReport& report);
+
+// Builds a report from the text of /proc/buddyinfo and of extfrag_index
+// (nullptr or empty when unreadable). report.pageSizeBytes and
+// report.hugePageOrder describe the system the text came from; when 0 they
+// are taken from the running kernel.
+bool Exs_ParseFragmentationReport(const char* buddyText, const char* extfragText, Exs_FragmentationReport& report);
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_MEMORY_FRAGMENTATION_H
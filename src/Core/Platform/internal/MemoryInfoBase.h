@@ -5,6 +5,7 @@
 #include "../../../include/Exs/Core/Types/BasicTypes.h"
 #include <string>
 #include <vector>
+#include <chrono>
 
 namespace Exs {
 namespace Internal {
@@ -69,6 +70,10 @@ struct Exs_MemoryErrorInfo {
     std::chrono::system_clock::time_point lastErrorTime;
 };
 
+// Pressure percentage reported where stalls cannot be measured; callers
+// that need an answer anyway fall back to a usage heuristic themselves
+constexpr double kExs_PressureUnavailable = -1.0;
+
 // Base memory info class
 class Exs_MemoryInfoBase {
 public:
@@ -126,7 +131,9 @@ public:
     virtual uint32 getNumaNodeCount() const = 0;
     virtual uint64 getNumaNodeMemory(uint32 node) const = 0;
     
-    // Memory pressure
+    // Memory pressure. The percentage is the share of the last 10 s some
+    // task spent stalled on memory (Linux PSI), not how much RAM is in use;
+    // kExs_PressureUnavailable where the platform does not measure stalls.
     virtual bool isMemoryPressureHigh() const = 0;
     virtual double getMemoryPressurePercentage() const = 0;
     
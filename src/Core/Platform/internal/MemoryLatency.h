@@ -0,0 +1,75 @@
+// src/Core/Platform/internal/MemoryLatency.h
+#ifndef EXS_INTERNAL_MEMORY_LATENCY_H
+#define EXS_INTERNAL_MEMORY_LATENCY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// Page size backing a latency curve
+enum class Exs_LatencyPageMode {
+    BasePages = 0, // 4K pages: DRAM points include page walks
+    HugePages = 1  // THP or hugetlb: mostly cache and DRAM latency
+};
+
+// Average dependent-load latency at one working-set size
+struct Exs_LatencyPoint {
+    uint64 workingSetBytes;
+    double nanoseconds;
+};
+
+// A plateau of the curve: a cache level, or memory
+struct Exs_LatencyLevel {
+    uint32 level;          // 1, 2, 3, ...; kExs_LatencyMemoryLevel for DRAM
+    uint64 capacityBytes;  // largest working set still on the plateau; 0 for DRAM
+    double nanoseconds;    // median latency of the plateau
+};
+
+constexpr uint32 kExs_LatencyMemoryLevel = 0;
+
+struct Exs_LatencyCurve {
+    uint32 cpuNode;    // NUMA node of the measuring CPU
+    uint32 memoryNode; // node the buffer was bound to
+    uint32 cpu;
+    Exs_LatencyPageMode pageMode;
+    bool hugePagesBacked; // false when huge pages were requested but not granted
+    std::vector<Exs_LatencyPoint> points; // ascending working-set size
+    std::vector<Exs_LatencyLevel> levels; // inferred from points
+};
+
+struct Exs_LatencyOptions {
+    uint64 minBytes = 4 * 1024;
+    uint64 maxBytes = 0;            // 0 = 8x the last-level cache (at least 1 GB), capped by free memory
+    uint32 stepsPerOctave = 2;
+    uint64 loadsPerPoint = 1 << 22; // timed dependent loads per working-set size
+    bool basePages = true;
+    bool hugePages = true;
+    bool remoteNodes = true;        // also bind the buffer to every other node with memory
+};
+
+struct Exs_LatencyReport {
+    std::vector<Exs_LatencyCurve> curves; // local curves first
+
+    // DRAM latency of the first local curve, 0 when none was measured
+    double getLocalMemoryNanoseconds() const;
+};
+
+// Dependent-load chase through a randomly ordered cycle of cache lines, so
+// neither the prefetchers nor memory-level parallelism can hide latency.
+// One pinned thread sweeps working sets from minBytes to maxBytes for each
+// page mode and memory node (platform specific).
+Exs_LatencyReport Exs_MeasureMemoryLatency(const Exs_LatencyOptions& options = Exs_LatencyOptions());
+
+// Splits a curve into plateaus: runs of points within 25% of the run's
+// first latency. Single-point runs are transitions between levels; the last
+// plateau of a multi-plateau curve is memory.
+std::vector<Exs_LatencyLevel> Exs_InferLatencyLevels(const std::vector<Exs_LatencyPoint>& points);
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_MEMORY_LATENCY_H
@@ -0,0 +1,107 @@
+// src/Core/Platform/internal/MemoryPressure.h
+#ifndef EXS_INTERNAL_MEMORY_PRESSURE_H
+#define EXS_INTERNAL_MEMORY_PRESSURE_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// Where pressure is read from
+enum class Exs_PressureSource {
+    System = 0, // /proc/pressure/memory
+    Cgroup = 1  // memory.pressure of this process's cgroup v2 group
+};
+
+// "some": at least one task stalled on memory; "full": all non-idle tasks did
+enum class Exs_PressureKind {
+    Some = 0,
+    Full = 1
+};
+
+// Share of wall time spent stalled, in percent, over three windows
+struct Exs_PressureStall {
+    double avg10;
+    double avg60;
+    double avg300;
+    uint64 totalMicroseconds; // cumulative stall time
+};
+
+struct Exs_MemoryPressure {
+    Exs_PressureStall some;
+    Exs_PressureStall full;
+};
+
+// False when the kernel has no PSI (CONFIG_PSI=n, psi=0) or the process is
+// not in a cgroup v2 hierarchy
+bool Exs_ReadMemoryPressure(Exs_PressureSource source, Exs_MemoryPressure& pressure);
+
+// Parses the text of a memory.pressure file; false without a "some" line
+bool Exs_ParseMemoryPressure(const char* text, Exs_MemoryPressure& pressure);
+
+// memory.pressure of this process's cgroup, empty without cgroup v2
+std::string Exs_GetCgroupMemoryPressurePath();
+
+// Fires when tasks stall for stallMicroseconds within any windowMicroseconds.
+// The kernel accepts windows of 0.5-10 s; unprivileged system-wide triggers
+// need a window that is a multiple of 2 s (Linux 6.4+).
+struct Exs_PressureTrigger {
+    Exs_PressureSource source = Exs_PressureSource::Cgroup;
+    Exs_PressureKind kind = Exs_PressureKind::Some;
+    uint32 stallMicroseconds = 150000;
+    uint32 windowMicroseconds = 2000000;
+};
+
+using Exs_PressureCallback = std::function<void(int32 trigger)>;
+
+// PSI triggers with one descriptor each, waited on with poll(). Nothing
+// wakes until the kernel reports a crossed threshold or stop() is called.
+// Triggers live until the monitor is destroyed.
+class Exs_MemoryPressureMonitor {
+public:
+    Exs_MemoryPressureMonitor();
+    ~Exs_MemoryPressureMonitor();
+
+    Exs_MemoryPressureMonitor(const Exs_MemoryPressureMonitor&) = delete;
+    Exs_MemoryPressureMonitor& operator=(const Exs_MemoryPressureMonitor&) = delete;
+
+    // Registers a trigger and returns its id, or -1 if the kernel refused it
+    int32 addTrigger(const Exs_PressureTrigger& trigger);
+
+    // Blocks up to timeoutMs (-1 = no limit) and returns the triggers that
+    // fired. Returns early with none when triggers change or stop() is called.
+    // Meant for one waiting thread at a time, not alongside start().
+    std::vector<int32> wait(int32 timeoutMs = -1);
+
+    // Calls callback from a background thread for every fired trigger
+    bool start(Exs_PressureCallback callback);
+    void stop();
+
+private:
+    struct Trigger {
+        int fd;
+        bool failed; // the group went away; no longer polled
+    };
+
+    void wake();
+
+    std::mutex mutex;
+    std::vector<Trigger> triggers;
+    int wakeFd;
+    std::atomic<bool> waiting{false};
+    std::atomic<bool> stopping{false};
+    std::thread thread;
+};
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_MEMORY_PRESSURE_H
@@ -0,0 +1,102 @@
+// src/Core/Platform/internal/NumaMemory.h
+#ifndef EXS_INTERNAL_NUMA_MEMORY_H
+#define EXS_INTERNAL_NUMA_MEMORY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include "MemInfoReader.h"
+#include "HugePageMemory.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+
+namespace Platform {
+class Exs_ThreadPool;
+}
+
+namespace MemoryInfo {
+
+// Memory of one NUMA node, from /sys/devices/system/node/nodeN
+struct Exs_NumaNodeInfo {
+    uint32 node;
+    uint64 totalBytes;
+    uint64 freeBytes;
+    uint64 usedBytes;
+    uint64 anonBytes;
+    uint64 hugePagesTotal;
+    uint64 hugePagesFree;
+    std::vector<uint32> cpus;
+    std::vector<uint32> distances; // SLIT distance to each node in Exs_GetNumaNodes() order
+    Exs_MemInfoValues values;      // every field of the node's meminfo
+};
+
+// Nodes that are online, in id order; one node 0 on kernels without NUMA
+std::vector<Exs_NumaNodeInfo> Exs_GetNumaNodes();
+bool Exs_GetNumaNodeInfo(uint32 node, Exs_NumaNodeInfo& info);
+
+// Node of a logical CPU, 0 when unknown
+uint32 Exs_GetNumaNodeOfCPU(uint32 cpu);
+
+// Online nodes that have memory (CPU-only nodes are left out)
+std::vector<uint32> Exs_GetNumaMemoryNodes();
+
+// Placement policy of a range or a thread, as the kernel's MPOL_* modes
+enum class Exs_NumaPolicy {
+    Default = 0,    // the thread's policy, usually first touch
+    Bind = 1,       // only the given nodes; allocation fails rather than spill
+    Preferred = 2,  // the first given node, falling back to others
+    Interleave = 3, // page by page round robin over the given nodes
+    Local = 4       // the node of the CPU that first touches the page
+};
+
+// Applies policy to [address, address + size), which must be page aligned.
+// Only pages faulted afterwards follow it unless movePages migrates the
+// ones already resident. Empty nodes means every node with memory.
+bool Exs_BindMemory(void* address, uint64 size, Exs_NumaPolicy policy,
+                    const std::vector<uint32>& nodes = {}, bool movePages = false);
+
+// Default policy for later allocations of the calling thread
+bool Exs_SetThreadNumaPolicy(Exs_NumaPolicy policy, const std::vector<uint32>& nodes = {});
+
+// Exs_AllocateLargeRegion with a placement policy set before any page is
+// touched. Free with Exs_FreeLargeRegion.
+Exs_LargeRegion Exs_AllocateOnNode(uint64 size, uint32 node, uint64 preferredPageSize = 0);
+Exs_LargeRegion Exs_AllocateInterleaved(uint64 size, const std::vector<uint32>& nodes = {},
+                                        uint64 preferredPageSize = 0);
+
+// Where the pages of a range actually are, from move_pages()
+struct Exs_NumaPlacement {
+    std::vector<uint64> pagesPerNode; // indexed by node id
+    uint64 sampledPages;
+    uint64 unmappedPages;             // not faulted in yet
+    uint64 pageSizeBytes;             // sampling stride
+
+    // Share of the resident sampled pages that are on node
+    double getNodeFraction(uint32 node) const;
+};
+
+// Samples one address per page of pageSizeBytes (0 = base page size)
+Exs_NumaPlacement Exs_GetNumaPlacement(const void* address, uint64 size, uint64 pageSizeBytes = 0);
+
+// First-touch helpers. Slice i of the range is faulted in by a thread
+// pinned to cpus[i], so under the default policy each slice lands on the
+// node of the CPU that will process it. Slices are whole pages of
+// pageSizeBytes (0 = base page size); pass the region's page size for THP
+// or hugetlb backing. Touching keeps the contents; pages that are already
+// resident do not move.
+void Exs_FirstTouchPartitioned(void* address, uint64 size, const std::vector<uint32>& cpus,
+                               uint64 pageSizeBytes = 0);
+
+// Slice i for worker i of a pinned pool, matching static partitioning
+void Exs_FirstTouchForPool(void* address, uint64 size, const Platform::Exs_ThreadPool& pool,
+                           uint64 pageSizeBytes = 0);
+
+// Every CPU of node touches an equal slice; nothing for CPU-less nodes,
+// which need Exs_BindMemory instead
+void Exs_FirstTouchOnNode(void* address, uint64 size, uint32 node, uint64 pageSizeBytes = 0);
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_NUMA_MEMORY_H
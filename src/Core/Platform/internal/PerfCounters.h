@@ -0,0 +1,83 @@
+// src/Core/Platform/internal/PerfCounters.h
+#ifndef EXS_INTERNAL_PERF_COUNTERS_H
+#define EXS_INTERNAL_PERF_COUNTERS_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// What a counter group observes
+enum class Exs_PerfCounterScope {
+    Thread = 0,  // the thread that opened the group
+    Process = 1, // every thread of the process alive when the group was opened
+    System = 2   // every online CPU (needs CAP_PERFMON or perf_event_paranoid <= 0)
+};
+
+// Hardware events of one group
+enum class Exs_PerfCounterEvent {
+    Cycles = 0,
+    Instructions = 1,
+    CacheMisses = 2,
+    BranchMisses = 3,
+    Count = 4
+};
+
+constexpr uint32 kExs_PerfCounterEventCount = static_cast<uint32>(Exs_PerfCounterEvent::Count);
+
+// Counts accumulated since the group was opened. Values are already scaled
+// by timeEnabled / timeRunning when the kernel multiplexed the counters.
+struct Exs_PerfCounterSample {
+    uint64 values[kExs_PerfCounterEventCount];
+    uint64 timeEnabledNs;
+    uint64 timeRunningNs;
+    bool multiplexed; // timeRunningNs < timeEnabledNs for at least one group
+
+    uint64 get(Exs_PerfCounterEvent event) const {
+        return values[static_cast<uint32>(event)];
+    }
+};
+
+// Instructions / cycles of a sample, or 0 when nothing was counted
+double Exs_GetInstructionsPerCycle(const Exs_PerfCounterSample& sample);
+
+struct Exs_PerfEventGroupHandle;
+
+// One perf_event_open group per observed task or CPU. Events the PMU does not
+// support are left out and read as 0. For the Thread scope on x86 the owning
+// thread reads the counters with rdpmc through the mmap'd control page, and
+// falls back to a single read() of the whole group otherwise.
+class Exs_PerfCounterGroup {
+public:
+    explicit Exs_PerfCounterGroup(Exs_PerfCounterScope scope);
+    ~Exs_PerfCounterGroup();
+
+    Exs_PerfCounterGroup(const Exs_PerfCounterGroup&) = delete;
+    Exs_PerfCounterGroup& operator=(const Exs_PerfCounterGroup&) = delete;
+
+    bool isOpen() const;
+    bool isEventAvailable(Exs_PerfCounterEvent event) const;
+    bool hasFastRead() const;
+    Exs_PerfCounterScope getScope() const;
+
+    // False when the group is not open or every read failed
+    bool read(Exs_PerfCounterSample& sample) const;
+
+    // Raw counts without multiplexing correction, indexed by event. Cheapest
+    // read for short deltas: rdpmc only, no time extrapolation.
+    bool readUnscaled(uint64 values[kExs_PerfCounterEventCount]) const;
+
+private:
+    Exs_PerfCounterScope scope;
+    uint32 ownerThreadId;
+    bool available[kExs_PerfCounterEventCount];
+    std::vector<Exs_PerfEventGroupHandle*> groups;
+};
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_PERF_COUNTERS_H
@@ -0,0 +1,74 @@
+// src/Core/Platform/internal/PlatformDescriptor.h
+#ifndef EXS_INTERNAL_PLATFORM_DESCRIPTOR_H
+#define EXS_INTERNAL_PLATFORM_DESCRIPTOR_H
+
+#include "PlatformBase.h"
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Architecture known to the compiler for this translation unit
+constexpr Exs_Architecture Exs_CompileTimeArchitecture() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+    return Exs_Architecture::x64;
+#elif defined(__i386__) || defined(_M_IX86)
+    return Exs_Architecture::x86;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return Exs_Architecture::ARM64;
+#elif defined(__arm__) || defined(_M_ARM)
+    return Exs_Architecture::ARM;
+#elif defined(__mips__)
+    return Exs_Architecture::MIPS;
+#elif defined(__powerpc__) || defined(__powerpc64__) || defined(_M_PPC)
+    return Exs_Architecture::PowerPC;
+#else
+    return Exs_Architecture::Unknown;
+#endif
+}
+
+// Byte order known to the compiler for this translation unit
+constexpr Exs_Endianness Exs_CompileTimeEndianness() {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return Exs_Endianness::Little;
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return Exs_Endianness::Big;
+#elif defined(_WIN32)
+    return Exs_Endianness::Little; // Every Windows target is little-endian
+#else
+    return Exs_Endianness::Unknown;
+#endif
+}
+
+// Immutable platform facts, computed once when the library is loaded
+struct Exs_PlatformDescriptor {
+    Exs_Architecture architecture;
+    Exs_Endianness endianness;
+
+    // Memory
+    uint32 pageSize;
+    uint32 cacheLineSize;
+
+    // CPU counts
+    uint32 physicalCoreCount;
+    uint32 logicalCoreCount;
+
+    // SIMD capabilities (already validated against OS register state)
+    bool hasSSE;
+    bool hasSSE2;
+    bool hasSSE42;
+    bool hasAVX;
+    bool hasAVX2;
+    bool hasAVX512F;
+    bool hasNEON;
+};
+
+// Returns the process-wide descriptor. The descriptor is built during static
+// initialization; reads afterwards perform no syscalls, locks or allocation.
+const Exs_PlatformDescriptor& Exs_GetPlatformDescriptor();
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_PLATFORM_DESCRIPTOR_H
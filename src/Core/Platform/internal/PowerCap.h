@@ -0,0 +1,118 @@
+// src/Core/Platform/internal/PowerCap.h
+#ifndef EXS_INTERNAL_POWER_CAP_H
+#define EXS_INTERNAL_POWER_CAP_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// What a RAPL domain measures
+enum class Exs_PowerDomainType {
+    Unknown = 0,
+    Package = 1,
+    Core = 2,     // PP0
+    Uncore = 3,   // PP1, usually the integrated GPU
+    DRAM = 4,
+    Platform = 5  // psys
+};
+
+// Where the energy counters come from
+enum class Exs_PowerSource {
+    None = 0,
+    Powercap = 1,  // /sys/class/powercap/intel-rapl* (Intel, and AMD on newer kernels)
+    AMDEnergy = 2, // amd_energy hwmon driver
+    MSR = 3        // /dev/cpu/N/msr, needs the msr module and CAP_SYS_RAWIO
+};
+
+// One domain as of the latest sample
+struct Exs_PowerDomainInfo {
+    std::string name;
+    Exs_PowerDomainType type;
+    uint32 packageId;
+    double powerWatts;        // average over the configured window
+    double powerLimitWatts;   // long-term limit, 0 when unknown
+    uint64 energyMicrojoules; // accumulated since the monitor was created, wrap-corrected
+};
+
+// Counter units since the previous reading. A smaller value means the
+// counter wrapped once at range (0 = never wraps).
+inline uint64 Exs_EnergyCounterDelta(uint64 previous, uint64 current, uint64 range) {
+    return current >= previous ? current - previous : current + range - previous;
+}
+
+// Accumulated energy readings of one domain. Every sample inside the window
+// is kept, plus the newest one older than it, so the history grows with the
+// window and the sampling rate instead of being cut at a fixed length.
+class Exs_EnergyHistory {
+public:
+    void add(uint64 timeNs, double microjoules, uint64 windowNs);
+
+    // Average power between the newest sample and the oldest one inside
+    // windowNs; 0 with fewer than two samples
+    double getWatts(uint64 windowNs) const;
+
+    size_t size() const { return timesNs.size(); }
+
+private:
+    std::deque<uint64> timesNs;
+    std::deque<double> microjoules;
+};
+
+struct Exs_PowerDomainState;
+
+// Reads every package and subdomain energy counter through descriptors
+// that stay open, one pread() per domain and sample. Watts are the energy
+// difference between the newest sample and the oldest one still inside the
+// window, so sampling at 10Hz with a 1s window gives a 1s moving average.
+class Exs_PowerMonitor {
+public:
+    explicit Exs_PowerMonitor(uint64 windowMs = 1000);
+    ~Exs_PowerMonitor();
+
+    Exs_PowerMonitor(const Exs_PowerMonitor&) = delete;
+    Exs_PowerMonitor& operator=(const Exs_PowerMonitor&) = delete;
+
+    Exs_PowerSource getSource() const;
+    void setWindow(uint64 windowMs);
+    uint64 getWindow() const;
+
+    // Reads all counters once; false when no source is available. When the
+    // previous sample is younger than minIntervalMs nothing is read and the
+    // current watts stay as they are, since RAPL counters only update about
+    // every millisecond; with a single sample so far the call waits out the
+    // rest of the interval instead.
+    bool sample(uint32 minIntervalMs = 0);
+
+    // True once two samples exist, i.e. watts are meaningful
+    bool hasInterval() const;
+
+    std::vector<Exs_PowerDomainInfo> getDomains() const;
+
+    // Sums over the package domains
+    double getPackagePowerWatts() const;
+    double getPackagePowerLimitWatts() const;
+
+private:
+    bool openPowercap();
+    bool openAMDEnergy();
+    bool openMSR();
+
+    mutable std::mutex mutex;
+    Exs_PowerSource source;
+    uint64 windowNs;
+    uint32 sampleCount;
+    uint64 lastSampleNs;
+    std::vector<Exs_PowerDomainState*> domains;
+};
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_POWER_CAP_H
@@ -0,0 +1,70 @@
+// src/Core/Platform/internal/ProcessLauncher.h
+#ifndef EXS_INTERNAL_PROCESS_LAUNCHER_H
+#define EXS_INTERNAL_PROCESS_LAUNCHER_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Receives a chunk of child output; the buffer is only valid during the call
+using Exs_ProcessOutputCallback = std::function<void(const char* data, size_t size)>;
+
+// Process launch options
+struct Exs_ProcessOptions {
+    // argv[0] is resolved through PATH
+    std::vector<std::string> arguments;
+    std::string workingDirectory;
+
+    // 0 means no deadline. It covers the wait for exit as well as output;
+    // on expiry the whole process group is killed.
+    uint32 timeoutMs = 0;
+
+    // By default stdin is /dev/null and stderr is captured. Inheriting them
+    // gives popen() semantics: the child reads our stdin and its errors go
+    // to our stderr (onStderr is then never called).
+    bool inheritStdin = false;
+    bool inheritStderr = false;
+
+    // Output streaming; a missing callback discards that stream. Reading
+    // stops once the child exits, even if a background descendant still
+    // holds the pipe open.
+    Exs_ProcessOutputCallback onStdout;
+    Exs_ProcessOutputCallback onStderr;
+    size_t readChunkSize = 64 * 1024;
+};
+
+// Process completion information
+struct Exs_ProcessResult {
+    bool launched = false;
+    bool timedOut = false;
+    bool exited = false;
+    int32 exitCode = -1;
+    int32 termSignal = 0;
+    int32 waitStatus = -1; // raw status as returned by waitpid()
+
+    // Resource usage of the child (and its reaped descendants)
+    uint64 userTimeUs = 0;
+    uint64 systemTimeUs = 0;
+    uint64 maxResidentKB = 0;
+    uint64 wallTimeUs = 0;
+};
+
+// Spawns a process without forking the caller's address space, streams its
+// stdout/stderr through poll() and waits for it, enforcing the deadline.
+Exs_ProcessResult Exs_RunProcess(const Exs_ProcessOptions& options);
+
+// Runs a command line through /bin/sh -c with popen()-like streams:
+// stdout is captured into output, stdin and stderr are inherited
+Exs_ProcessResult Exs_RunShellCommand(const std::string& command, uint32 timeoutMs = 0,
+                                      std::string* output = nullptr);
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_PROCESS_LAUNCHER_H
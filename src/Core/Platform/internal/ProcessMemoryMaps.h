@@ -0,0 +1,85 @@
+// src/Core/Platform/internal/ProcessMemoryMaps.h
+#ifndef EXS_INTERNAL_PROCESS_MEMORY_MAPS_H
+#define EXS_INTERNAL_PROCESS_MEMORY_MAPS_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <type_traits>
+
+namespace Exs {
+namespace Internal {
+namespace MemoryInfo {
+
+// smaps counters of one mapping or of a whole process, in bytes
+struct Exs_MappingCounters {
+    uint64 rss;
+    uint64 pss;
+    uint64 pssAnon;       // rollup only
+    uint64 pssFile;       // rollup only
+    uint64 pssShmem;      // rollup only
+    uint64 sharedClean;
+    uint64 sharedDirty;
+    uint64 privateClean;
+    uint64 privateDirty;
+    uint64 referenced;
+    uint64 anonymous;
+    uint64 swap;
+    uint64 swapPss;
+    uint64 anonHugePages; // THP
+    uint64 hugetlb;       // Shared_Hugetlb + Private_Hugetlb, not part of rss
+    uint64 locked;
+};
+
+// How much of each mapping to read
+enum class Exs_MappingDetail {
+    Ranges = 0, // /proc/<pid>/maps: addresses, permissions and file only
+    Full = 1    // /proc/<pid>/smaps: also every counter (the kernel walks page tables)
+};
+
+struct Exs_MappingInfo {
+    uint64 start;
+    uint64 end;
+    char permissions[5]; // "rw-p", NUL-terminated
+    uint64 offset;
+    uint64 inode;
+    const char* path;    // file, "[heap]", "[stack]" or ""; valid during the visit only
+    uint64 kernelPageSizeBytes; // Full only
+    Exs_MappingCounters counters; // Full only
+};
+
+using Exs_MappingVisitFunction = void (*)(const Exs_MappingInfo& mapping, void* context);
+
+// Streams the mappings of pid (0 = this process) through a fixed stack
+// buffer and calls visit once per mapping. Nothing is allocated, so
+// processes with 100k mappings cost one read() per buffer refill.
+bool Exs_ForEachMapping(int32 pid, Exs_MappingDetail detail, Exs_MappingVisitFunction visit, void* context);
+
+template <typename Visitor>
+bool Exs_ForEachMapping(int32 pid, Exs_MappingDetail detail, Visitor&& visit) {
+    using VisitorType = std::remove_reference_t<Visitor>;
+    return Exs_ForEachMapping(pid, detail, [](const Exs_MappingInfo& mapping, void* context) {
+        (*static_cast<VisitorType*>(context))(mapping);
+    }, const_cast<void*>(static_cast<const void*>(&visit)));
+}
+
+// Same walk over a maps or smaps file at any path, such as a copy saved
+// from another machine
+bool Exs_ForEachMappingInFile(const char* path, Exs_MappingVisitFunction visit, void* context);
+
+template <typename Visitor>
+bool Exs_ForEachMappingInFile(const char* path, Visitor&& visit) {
+    using VisitorType = std::remove_reference_t<Visitor>;
+    return Exs_ForEachMappingInFile(path, [](const Exs_MappingInfo& mapping, void* context) {
+        (*static_cast<VisitorType*>(context))(mapping);
+    }, const_cast<void*>(static_cast<const void*>(&visit)));
+}
+
+// Process totals from /proc/<pid>/smaps_rollup, which the kernel sums in
+// one pass without per-mapping output. Before Linux 4.14 the totals are
+// summed from smaps instead (the Pss* split is then left at 0).
+bool Exs_ReadMemoryRollup(int32 pid, Exs_MappingCounters& totals);
+
+} // namespace MemoryInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_PROCESS_MEMORY_MAPS_H
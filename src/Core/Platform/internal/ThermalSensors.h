@@ -0,0 +1,76 @@
+// src/Core/Platform/internal/ThermalSensors.h
+#ifndef EXS_INTERNAL_THERMAL_SENSORS_H
+#define EXS_INTERNAL_THERMAL_SENSORS_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// What a temperature input covers
+enum class Exs_ThermalSensorKind {
+    Other = 0,
+    Package = 1, // coretemp "Package id N", k10temp Tctl/Tdie
+    Core = 2,    // coretemp "Core N"
+    Die = 3,     // k10temp TccdN
+    Zone = 4     // thermal_zone fallback
+};
+
+// One discovered input
+struct Exs_ThermalSensorInfo {
+    std::string label;
+    Exs_ThermalSensorKind kind;
+    uint32 packageId;
+    uint32 coreId;         // topology core_id for Core sensors
+    int32 criticalCelsius; // 0 when not reported
+};
+
+// Sets kind from a coretemp/k10temp label. "Package id N" also sets
+// packageId and "Core N" sets coreId; other fields are left as they are.
+void Exs_ClassifyThermalLabel(Exs_ThermalSensorInfo& info);
+
+// CPU temperature inputs found once at construction (coretemp, k10temp,
+// then CPU thermal zones). Every input keeps its descriptor open, and a
+// read is one pread() per input with no directory walks.
+class Exs_ThermalSensors {
+public:
+    Exs_ThermalSensors();
+    ~Exs_ThermalSensors();
+
+    Exs_ThermalSensors(const Exs_ThermalSensors&) = delete;
+    Exs_ThermalSensors& operator=(const Exs_ThermalSensors&) = delete;
+
+    const std::vector<Exs_ThermalSensorInfo>& getSensors() const;
+
+    // Sensor that best describes a logical CPU: its core, else its package; -1 if none
+    int32 getSensorForCPU(uint32 cpu) const;
+
+    // One sweep over all inputs, in millidegrees Celsius indexed like getSensors().
+    // Inputs that fail to read report INT32_MIN.
+    bool readAll(std::vector<int32>& milliCelsius) const;
+
+    // Hottest package (or any) sensor, in degrees Celsius
+    int32 readHottestPackage() const;
+
+    // One sweep, then degrees Celsius per requested logical CPU
+    std::vector<int32> readCPUTemperatures(const std::vector<uint32>& cpus) const;
+
+private:
+    void addInput(const std::string& path, const Exs_ThermalSensorInfo& info);
+    void discoverHwmon();
+    void discoverThermalZones();
+    void mapCPUs();
+
+    std::vector<Exs_ThermalSensorInfo> sensors;
+    std::vector<int> fds;
+    std::vector<int32> cpuSensors; // indexed by logical CPU id
+};
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_THERMAL_SENSORS_H
@@ -0,0 +1,114 @@
+// src/Core/Platform/internal/ThreadPool.h
+#ifndef EXS_INTERNAL_THREAD_POOL_H
+#define EXS_INTERNAL_THREAD_POOL_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <deque>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Which logical CPUs get a pinned worker
+enum class Exs_ThreadPinningPolicy {
+    None = 0,            // one unpinned worker per logical CPU
+    PhysicalCores = 1,   // one worker per physical core, SMT siblings left idle
+    AllLogicalCores = 2  // one worker per logical CPU, including SMT siblings
+};
+
+// Where a worker runs, and what it shares with other workers
+struct Exs_WorkerPlacement {
+    uint32 cpu;          // logical CPU the worker is pinned to
+    uint32 coreKey;      // equal for SMT siblings of one physical core
+    uint32 cacheKey;     // equal for CPUs sharing the last-level cache
+    uint32 numaNodeId;
+    uint32 socketId;
+    bool isHyperThread;  // not the first thread of its core
+};
+
+// Thread pool construction options
+struct Exs_ThreadPoolOptions {
+    Exs_ThreadPinningPolicy pinning = Exs_ThreadPinningPolicy::PhysicalCores;
+    uint32 workerCount = 0; // 0 = one per selected CPU
+    std::string name = "exs-worker";
+};
+
+using Exs_ThreadPoolTask = std::function<void()>;
+
+// Logical CPUs selected by the policy, in topology order (platform specific)
+std::vector<Exs_WorkerPlacement> Exs_DetectWorkerPlacements(Exs_ThreadPinningPolicy policy);
+
+// Pins the calling thread to one logical CPU (platform specific)
+bool Exs_PinCurrentThreadToCPU(uint32 cpu);
+
+class Exs_WorkStealingDeque;
+
+// Work-stealing pool with one Chase-Lev deque per worker. Idle workers steal
+// from victims ordered by proximity: same core, same last-level cache, same
+// NUMA node, same socket, then everyone else.
+class Exs_ThreadPool {
+public:
+    explicit Exs_ThreadPool(const Exs_ThreadPoolOptions& options = Exs_ThreadPoolOptions());
+    ~Exs_ThreadPool();
+
+    Exs_ThreadPool(const Exs_ThreadPool&) = delete;
+    Exs_ThreadPool& operator=(const Exs_ThreadPool&) = delete;
+
+    // Queues a task; from a worker it goes to that worker's own deque
+    void submit(Exs_ThreadPoolTask task);
+
+    // Splits [begin, end) into chunks of at most grain and waits for all of
+    // them. A calling worker executes tasks while it waits.
+    void parallelFor(uint64 begin, uint64 end, uint64 grain,
+                     const std::function<void(uint64 begin, uint64 end)>& body);
+
+    // Blocks until every submitted task has finished. Called from a task,
+    // it waits for every task except those also inside waitIdle().
+    void waitIdle();
+
+    uint32 getWorkerCount() const;
+    const Exs_WorkerPlacement& getWorkerPlacement(uint32 worker) const;
+
+    // Index of the calling worker in this pool, or -1
+    int32 getCurrentWorkerIndex() const;
+
+private:
+    struct Worker;
+
+    void workerMain(uint32 index);
+    bool runOneTask(int32 workerIndex);
+    void finishTask();
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Submissions from threads outside the pool
+    std::mutex injectionMutex;
+    std::deque<Exs_ThreadPoolTask*> injectionQueue;
+
+    // Sleeping and shutdown
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::atomic<int64> queuedTasks{0};
+    std::atomic<int32> sleepingWorkers{0};
+    std::atomic<bool> stopping{false};
+
+    // Completion tracking for waitIdle()
+    std::mutex idleMutex;
+    std::condition_variable idleCondition;
+    std::atomic<int64> outstandingTasks{0};
+    std::atomic<int64> idleWaitingTasks{0}; // tasks blocked in waitIdle()
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_THREAD_POOL_H
@@ -0,0 +1,60 @@
+// src/Core/Platform/internal/ThreadRegistry.h
+#ifndef EXS_INTERNAL_THREAD_REGISTRY_H
+#define EXS_INTERNAL_THREAD_REGISTRY_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace Platform {
+
+// Capacity limits of the registry
+constexpr uint32 kExs_MaxRegisteredThreads = 1024;
+constexpr uint32 kExs_MaxAffinityCPUs = 1024;
+constexpr uint32 kExs_ThreadNameLength = 32;
+
+// Snapshot of one registered thread
+struct Exs_ThreadRecord {
+    uint32 threadId;
+    char name[kExs_ThreadNameLength];
+    char role[kExs_ThreadNameLength];
+    uint64 affinityMask[kExs_MaxAffinityCPUs / 64]; // bit N set when CPU N is allowed
+    uint32 affinityCPUCount;
+};
+
+// Queries the kernel thread id (gettid() on Linux); prefer the cached form
+uint32 Exs_QueryOSThreadId();
+
+// Cached per thread and reset in the child after fork()
+inline thread_local uint32 t_exsOSThreadId = 0;
+
+// Kernel thread id of the caller; a single thread-local load after the first call
+inline uint32 Exs_GetOSThreadId() {
+    uint32 threadId = t_exsOSThreadId;
+    if (threadId == 0) {
+        threadId = Exs_QueryOSThreadId();
+        t_exsOSThreadId = threadId;
+    }
+    return threadId;
+}
+
+// Registers (or updates) the calling thread. The name is also applied to the
+// OS thread, truncated to the platform limit. Affinity is captured from the
+// scheduler. The slot is released automatically when the thread exits.
+bool Exs_RegisterCurrentThread(const char* name, const char* role);
+void Exs_UnregisterCurrentThread();
+
+// Re-reads the calling thread's CPU affinity into its registry slot
+void Exs_RefreshCurrentThreadAffinity();
+
+// Lock-free readers; safe to call from any thread, including while writers
+// register, update or unregister
+bool Exs_LookupThread(uint32 threadId, Exs_ThreadRecord& record);
+std::vector<Exs_ThreadRecord> Exs_SnapshotThreadRegistry();
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_THREAD_REGISTRY_H
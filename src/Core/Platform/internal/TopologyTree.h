@@ -0,0 +1,68 @@
+// src/Core/Platform/internal/TopologyTree.h
+#ifndef EXS_INTERNAL_TOPOLOGY_TREE_H
+#define EXS_INTERNAL_TOPOLOGY_TREE_H
+
+#include "../../../include/Exs/Core/Types/BasicTypes.h"
+#include "CPUInfoBase.h"
+#include <string>
+#include <vector>
+
+namespace Exs {
+namespace Internal {
+namespace CPUInfo {
+
+// Levels of the tree, outermost first
+enum class Exs_TopologyNodeType {
+    Machine = 0,
+    Package = 1,
+    NumaNode = 2,
+    L3Cache = 3,
+    L2Cache = 4,
+    Core = 5,
+    PU = 6 // processing unit: one logical CPU
+};
+
+// One object of the tree. Cache levels the machine does not have are
+// skipped, and an object that straddles its parent, e.g. an L3 shared by
+// two sub-NUMA clusters, appears under each parent with the same id.
+struct Exs_TopologyNode {
+    Exs_TopologyNodeType type;
+    uint32 id;                // package, node, cache or core id; CPU number for a PU
+    uint32 sizeKB;            // caches only
+    Exs_CPUCoreType coreType; // cores and PUs only
+    std::vector<uint32> cpus; // PUs below this node, ascending
+    std::vector<Exs_TopologyNode> children;
+};
+
+// Whole machine, built once in a single sysfs pass (platform specific)
+const Exs_TopologyNode& Exs_GetTopologyTree();
+
+// Lower-case name used in the JSON form, e.g. "numa_node"
+const char* Exs_GetTopologyNodeTypeName(Exs_TopologyNodeType type);
+
+// Depth-first, parents before children; visit(node, depth)
+template <typename Visitor>
+void Exs_WalkTopology(const Exs_TopologyNode& node, Visitor&& visit, uint32 depth = 0) {
+    visit(node, depth);
+    for (const Exs_TopologyNode& child : node.children) {
+        Exs_WalkTopology(child, visit, depth + 1);
+    }
+}
+
+// Every node of one type below root, in tree order
+std::vector<const Exs_TopologyNode*> Exs_GetTopologyNodes(const Exs_TopologyNode& root, Exs_TopologyNodeType type);
+
+// Kernel list syntax, e.g. "0-3,8,10-11"; cpus must be ascending
+std::string Exs_FormatCPUList(const std::vector<uint32>& cpus);
+
+// Compact JSON, e.g. {"type":"core","id":2,"cpus":"2,6","core_type":"performance","children":[...]}
+std::string Exs_TopologyToJSON(const Exs_TopologyNode& node);
+
+// JSON of Exs_GetTopologyTree(), serialized once (platform specific)
+const std::string& Exs_GetTopologyJSON();
+
+} // namespace CPUInfo
+} // namespace Internal
+} // namespace Exs
+
+#endif // EXS_INTERNAL_TOPOLOGY_TREE_H
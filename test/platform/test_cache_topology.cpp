@@ -0,0 +1,126 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <sched.h>
+#include "../../src/Core/Platform/internal/CacheTopology.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+// Slices are contiguous, cover [begin, end) and follow the CPU counts
+static bool Exs_CoversRange(const std::vector<Exs_CacheWorkPartition>& partitions, uint64_t begin, uint64_t end) {
+    uint64_t cursor = begin;
+    uint64_t cpuCount = 0;
+    for (const Exs_CacheWorkPartition& partition : partitions) {
+        cpuCount += partition.cpus.size();
+    }
+    for (const Exs_CacheWorkPartition& partition : partitions) {
+        if (partition.begin != cursor || partition.end < partition.begin || partition.cpus.empty()) {
+            return false;
+        }
+
+        // Within one item of the exact proportional share
+        double share = static_cast<double>(end - begin) * partition.cpus.size() / cpuCount;
+        double size = static_cast<double>(partition.end - partition.begin);
+        if (size < share - 1.0 || size > share + 1.0) {
+            return false;
+        }
+        cursor = partition.end;
+    }
+    return cursor == end;
+}
+
+int main() {
+    std::cout << "=== Exs Cache Topology Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: The last-level domains list every online CPU once
+    total++;
+    std::vector<const Exs_CacheDomain*> llc = Exs_GetCacheDomainsAtLevel(0);
+    std::vector<uint32_t> seen;
+    for (const Exs_CacheDomain* domain : llc) {
+        seen.insert(seen.end(), domain->cpus.begin(), domain->cpus.end());
+    }
+    std::sort(seen.begin(), seen.end());
+    if (llc.empty() || std::adjacent_find(seen.begin(), seen.end()) == seen.end()) {
+        std::cout << "✓ " << llc.size() << " last-level domains\n";
+        passed++;
+    } else {
+        std::cout << "✗ A CPU appears in two last-level domains\n";
+    }
+
+    if (llc.empty()) {
+        std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+        return (passed == total) ? 0 : 1;
+    }
+
+    // Test 2: A range splits over the allowed CPUs of each domain
+    total++;
+    std::vector<Exs_CacheWorkPartition> partitions = Exs_PartitionWorkByCache(100, 100100);
+    bool inside = !partitions.empty();
+    for (const Exs_CacheWorkPartition& partition : partitions) {
+        const Exs_CacheDomain& domain = Exs_GetCacheDomains()[partition.domainIndex];
+        for (uint32_t cpu : partition.cpus) {
+            inside = inside && std::binary_search(domain.cpus.begin(), domain.cpus.end(), cpu);
+        }
+    }
+    if (inside && Exs_CoversRange(partitions, 100, 100100)) {
+        std::cout << "✓ " << partitions.size() << " partitions cover the range\n";
+        passed++;
+    } else {
+        std::cout << "✗ Partitions do not cover the range\n";
+    }
+
+    // Test 3: Fewer items than CPUs still covers the range exactly
+    total++;
+    partitions = Exs_PartitionWorkByCache(7, 8);
+    if (Exs_CoversRange(partitions, 7, 8)) {
+        std::cout << "✓ Single item assigned\n";
+        passed++;
+    } else {
+        std::cout << "✗ Single item lost\n";
+    }
+
+    // Test 4: An empty range gives empty slices at begin
+    total++;
+    partitions = Exs_PartitionWorkByCache(5, 5);
+    bool empty = !partitions.empty();
+    for (const Exs_CacheWorkPartition& partition : partitions) {
+        empty = empty && partition.begin == 5 && partition.end == 5;
+    }
+    if (empty) {
+        std::cout << "✓ Empty range\n";
+        passed++;
+    } else {
+        std::cout << "✗ Empty range mishandled\n";
+    }
+
+    // Test 5: Only CPUs in the affinity mask are used, and pinning follows a domain
+    total++;
+    const Exs_CacheDomain& first = *llc.front();
+    bool pinned = Exs_PinCurrentThreadToCacheDomain(first);
+    partitions = Exs_PartitionWorkByCache(0, 1000);
+    bool restricted = pinned && partitions.size() == 1 && partitions[0].domainIndex == first.index &&
+                      Exs_CoversRange(partitions, 0, 1000);
+    int current = sched_getcpu();
+    restricted = restricted && std::binary_search(first.cpus.begin(), first.cpus.end(), static_cast<uint32_t>(current));
+    if (restricted) {
+        std::cout << "✓ Pinned to domain " << first.index << ", running on CPU " << current << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Affinity not honoured\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include "../../src/Core/Platform/internal/CoreFrequency.h"
+#include "../../src/Core/Platform/Linux/SysfsLinux.h"
+
+using namespace Exs::Internal::CPUInfo;
+using Exs::Internal::Platform::Exs_GetMonotonicNanoseconds;
+using Exs::Internal::Platform::Exs_KeepLastSample;
+
+int main() {
+    std::cout << "=== Exs Core Frequency Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: The first reading only sets the baseline, the next one gives base * dAPERF / dMPERF
+    total++;
+    Exs_FrequencyCounterState state;
+    uint32_t first = Exs_UpdateFrequencyCounter(state, 1000, 1000, 2000);
+    uint32_t turbo = Exs_UpdateFrequencyCounter(state, 4000, 2500, 2000);
+    uint32_t throttled = Exs_UpdateFrequencyCounter(state, 4500, 3500, 2000);
+    if (first == 0 && turbo == 4000 && throttled == 1000) {
+        std::cout << "✓ Ratios give " << turbo << " and " << throttled << " MHz\n";
+        passed++;
+    } else {
+        std::cout << "✗ Ratios give " << first << ", " << turbo << ", " << throttled << " MHz\n";
+    }
+
+    // Test 2: A halted CPU repeats its last frequency and keeps its baseline
+    total++;
+    uint32_t idle = Exs_UpdateFrequencyCounter(state, 4500, 3500, 2000);
+    bool baselineKept = state.lastAPERF == 4500 && state.lastMPERF == 3500;
+    uint32_t resumed = Exs_UpdateFrequencyCounter(state, 7500, 5000, 2000);
+    if (idle == 1000 && baselineKept && resumed == 4000) {
+        std::cout << "✓ Idle interval repeats " << idle << " MHz\n";
+        passed++;
+    } else {
+        std::cout << "✗ Idle interval gave " << idle << " MHz, then " << resumed << " MHz\n";
+    }
+
+    // Test 3: Counters that went backwards report nothing and restart the interval
+    total++;
+    uint32_t reset = Exs_UpdateFrequencyCounter(state, 100, 6000, 2000);
+    uint32_t after = Exs_UpdateFrequencyCounter(state, 1100, 7000, 2000);
+    if (reset == 0 && after == 2000) {
+        std::cout << "✓ Counter reset skipped one interval\n";
+        passed++;
+    } else {
+        std::cout << "✗ Counter reset gave " << reset << ", then " << after << " MHz\n";
+    }
+
+    // Test 4: Young readings are kept with a result and waited out without one
+    total++;
+    uint64_t now = Exs_GetMonotonicNanoseconds();
+    bool keep = Exs_KeepLastSample(now, 1000, true);
+    bool stale = !Exs_KeepLastSample(now - 2000000000ULL, 1000, true);
+    auto start = std::chrono::steady_clock::now();
+    bool waitedOut = !Exs_KeepLastSample(Exs_GetMonotonicNanoseconds(), 50, false);
+    auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    if (keep && stale && waitedOut && waited.count() >= 45) {
+        std::cout << "✓ Minimum interval waited " << waited.count() << " ms\n";
+        passed++;
+    } else {
+        std::cout << "✗ Minimum interval handling (waited " << waited.count() << " ms)\n";
+    }
+
+    // Test 5: A sampler with a source reports every requested CPU
+    total++;
+    Exs_CoreFrequencySampler sampler({ 0 }, 2000);
+    std::vector<Exs_CoreFrequencySample> samples;
+    bool haveSource = sampler.getSource() != Exs_FrequencySource::None;
+    bool sampled = sampler.sample(samples, 10);
+    if (sampled == haveSource && samples.size() == (haveSource ? 1u : 0u) && (!haveSource || samples[0].cpu == 0)) {
+        std::cout << "✓ " << samples.size() << " CPU samples\n";
+        passed++;
+    } else {
+        std::cout << "✗ Sampler output does not match its source\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <sched.h>
+#include "../../src/Core/Platform/internal/CoreTypes.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+int main() {
+    std::cout << "=== Exs Core Types Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    const std::vector<Exs_CoreTypeInfo>& types = Exs_GetCoreTypes();
+
+    // Test 1: Every online CPU is classified, ascending
+    total++;
+    bool ordered = !types.empty();
+    for (size_t i = 1; i < types.size(); i++) {
+        ordered = ordered && types[i - 1].cpu < types[i].cpu;
+    }
+    if (ordered) {
+        std::cout << "✓ " << types.size() << " CPUs classified\n";
+        passed++;
+    } else {
+        std::cout << "✗ CPU list empty or unordered\n";
+    }
+
+    // Test 2: Only the fastest class is Performance and has full capacity;
+    // slower ones are Efficiency with a known, smaller capacity
+    total++;
+    uint32_t fastest = 0;
+    for (const Exs_CoreTypeInfo& info : types) {
+        fastest = info.capacity > fastest ? info.capacity : fastest;
+    }
+    bool consistent = fastest == 1024;
+    for (const Exs_CoreTypeInfo& info : types) {
+        if (info.type == Exs_CPUCoreType::Performance) {
+            consistent = consistent && info.capacity == 1024;
+        } else if (info.type == Exs_CPUCoreType::Efficiency) {
+            consistent = consistent && info.capacity > 0 && info.capacity < 1024;
+        } else {
+            consistent = false;
+        }
+    }
+    if (consistent) {
+        std::cout << "✓ Types agree with capacities\n";
+        passed++;
+    } else {
+        std::cout << "✗ Type/capacity mismatch\n";
+    }
+
+    // Test 3: Hybrid exactly when both classes are present, with a source
+    total++;
+    bool hybrid = !Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Performance).empty() &&
+                  !Exs_GetCPUsOfCoreType(Exs_CPUCoreType::Efficiency).empty();
+    if (Exs_IsHybridCPU() == hybrid && (hybrid == (Exs_GetCoreTypeSource() != Exs_CoreTypeSource::None))) {
+        std::cout << "✓ Hybrid: " << (hybrid ? "yes" : "no") << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Hybrid detection inconsistent\n";
+    }
+
+    // Test 4: Lookup by CPU
+    total++;
+    const Exs_CoreTypeInfo* first = types.empty() ? nullptr : Exs_GetCoreTypeOfCPU(types.front().cpu);
+    if (first != nullptr && first->cpu == types.front().cpu && Exs_GetCoreTypeOfCPU(1u << 20) == nullptr) {
+        std::cout << "✓ Lookup by CPU\n";
+        passed++;
+    } else {
+        std::cout << "✗ Lookup by CPU failed\n";
+    }
+
+    // Test 5: Pinning to a core type keeps the thread on that type
+    total++;
+    Exs_CPUCoreType pinnedType = types.empty() ? Exs_CPUCoreType::Unknown : types.front().type;
+    std::vector<uint32_t> ofType = Exs_GetCPUsOfCoreType(pinnedType);
+    bool pinned = Exs_PinCurrentThreadToCoreType(pinnedType);
+    int current = sched_getcpu();
+    if (pinned && std::find(ofType.begin(), ofType.end(), static_cast<uint32_t>(current)) != ofType.end()) {
+        std::cout << "✓ Pinned to core type, running on CPU " << current << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Pinning to core type failed\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
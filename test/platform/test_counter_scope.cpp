@@ -0,0 +1,126 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../../src/Core/Platform/internal/CounterScope.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+// Same text at two addresses: tables key by pointer, collection by content
+static const char s_mergedName[] = "merged";
+static char s_mergedCopy[] = "merged";
+
+static const Exs_CounterRegionStats* Exs_FindRegion(const std::vector<Exs_CounterRegionStats>& regions,
+                                                    const char* name) {
+    for (const Exs_CounterRegionStats& region : regions) {
+        if (region.name == name) {
+            return &region;
+        }
+    }
+    return nullptr;
+}
+
+int main() {
+    std::cout << "=== Exs Counter Scope Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Calls and deltas add up per region on this thread
+    total++;
+    const uint64_t outerDeltas[kExs_PerfCounterEventCount] = { 100, 200, 3, 4 };
+    for (int i = 0; i < 3; i++) {
+        Exs_RecordCounterRegion("outer", outerDeltas);
+    }
+    std::vector<Exs_CounterRegionStats> regions = Exs_CollectCounterRegions();
+    const Exs_CounterRegionStats* outer = Exs_FindRegion(regions, "outer");
+    if (outer != nullptr && outer->calls == 3 && outer->get(Exs_PerfCounterEvent::Cycles) == 300 &&
+        outer->get(Exs_PerfCounterEvent::Instructions) == 600 && outer->get(Exs_PerfCounterEvent::BranchMisses) == 12) {
+        std::cout << "✓ outer: " << outer->calls << " calls, "
+                  << outer->get(Exs_PerfCounterEvent::Cycles) << " cycles\n";
+        passed++;
+    } else {
+        std::cout << "✗ outer region missing or miscounted\n";
+    }
+
+    // Test 2: Regions of exited threads and equal names at other addresses are merged
+    total++;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([]() {
+            const uint64_t deltas[kExs_PerfCounterEventCount] = { 10, 20, 0, 0 };
+            for (int i = 0; i < 5; i++) {
+                Exs_RecordCounterRegion("worker", deltas);
+            }
+            Exs_RecordCounterRegion(s_mergedName, deltas);
+            Exs_RecordCounterRegion(s_mergedCopy, deltas);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    regions = Exs_CollectCounterRegions();
+    const Exs_CounterRegionStats* worker = Exs_FindRegion(regions, "worker");
+    const Exs_CounterRegionStats* merged = Exs_FindRegion(regions, "merged");
+    if (worker != nullptr && worker->calls == 20 && worker->get(Exs_PerfCounterEvent::Cycles) == 200 &&
+        merged != nullptr && merged->calls == 8) {
+        std::cout << "✓ worker: " << worker->calls << " calls from 4 threads\n";
+        passed++;
+    } else {
+        std::cout << "✗ worker region not merged\n";
+    }
+
+    // Test 3: Regions are sorted by cycles
+    total++;
+    bool sorted = regions.size() == 3;
+    for (size_t i = 1; i < regions.size(); i++) {
+        sorted = sorted && regions[i - 1].get(Exs_PerfCounterEvent::Cycles) >= regions[i].get(Exs_PerfCounterEvent::Cycles);
+    }
+    if (sorted && regions[0].name == "outer") {
+        std::cout << "✓ Sorted by cycles\n";
+        passed++;
+    } else {
+        std::cout << "✗ Regions out of order\n";
+    }
+
+    // Test 4: Reset starts live and retired regions from zero
+    total++;
+    Exs_ResetCounterRegions();
+    Exs_RecordCounterRegion("outer", outerDeltas);
+    regions = Exs_CollectCounterRegions();
+    outer = Exs_FindRegion(regions, "outer");
+    worker = Exs_FindRegion(regions, "worker");
+    if (outer != nullptr && outer->calls == 1 && outer->get(Exs_PerfCounterEvent::Cycles) == 100 &&
+        worker == nullptr) {
+        std::cout << "✓ Reset\n";
+        passed++;
+    } else {
+        std::cout << "✗ Totals survived the reset\n";
+    }
+
+    // Test 5: Scopes record only when hardware counters are available
+    total++;
+    bool countersOpen = Exs_PerfCounterGroup(Exs_PerfCounterScope::Thread).isOpen();
+    {
+        Exs_CounterScope scope("live");
+    }
+    const Exs_CounterRegionStats* live = Exs_FindRegion(Exs_CollectCounterRegions(), "live");
+    if ((live != nullptr) == countersOpen) {
+        std::cout << "✓ Scope recorded " << (live != nullptr ? live->calls : 0) << " calls\n";
+        passed++;
+    } else {
+        std::cout << "✗ Scope recording does not match counter availability\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
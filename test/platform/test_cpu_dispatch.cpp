@@ -0,0 +1,99 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include "../../src/Core/Platform/internal/CPUDispatch.h"
+#include "../../src/Core/Platform/internal/PlatformDescriptor.h"
+
+using namespace Exs::Internal::Platform;
+
+static int Exs_ScalarKernel(int value) { return value + 1; }
+static int Exs_SSE2Kernel(int value) { return value + 2; }
+static int Exs_AVX2Kernel(int value) { return value + 3; }
+static int Exs_AVX512Kernel(int value) { return value + 4; }
+
+int main() {
+    // Read once on first use, so the cap has to be set before any query
+    setenv("EXS_DISPATCH_MAX", "sse2", 1);
+
+    std::cout << "=== Exs CPU Dispatch Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: The cap keeps the scalar fallback and drops everything above SSE2
+    total++;
+    const Exs_PlatformDescriptor& descriptor = Exs_GetPlatformDescriptor();
+    if (Exs_IsDispatchTargetSupported(Exs_DispatchTarget::Scalar) &&
+        Exs_IsDispatchTargetSupported(Exs_DispatchTarget::SSE2) == descriptor.hasSSE2 &&
+        !Exs_IsDispatchTargetSupported(Exs_DispatchTarget::NEON) &&
+        !Exs_IsDispatchTargetSupported(Exs_DispatchTarget::AVX2) &&
+        !Exs_IsDispatchTargetSupported(Exs_DispatchTarget::AVX512)) {
+        std::cout << "✓ Capped at " << Exs_GetDispatchTargetName(Exs_GetBestDispatchTarget()) << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ EXS_DISPATCH_MAX not honoured\n";
+    }
+
+    // Test 2: The best registered and supported variant is selected
+    total++;
+    Exs_CPUDispatch<int(int)> kernel("test_kernel", {
+        { Exs_DispatchTarget::Scalar, &Exs_ScalarKernel },
+        { Exs_DispatchTarget::AVX2, &Exs_AVX2Kernel },
+        { Exs_DispatchTarget::AVX512, &Exs_AVX512Kernel } });
+    if (kernel.selectedTarget() == Exs_DispatchTarget::Scalar && kernel(10) == 11) {
+        std::cout << "✓ Scalar selected without a supported variant\n";
+        passed++;
+    } else {
+        std::cout << "✗ Selected " << Exs_GetDispatchTargetName(kernel.selectedTarget()) << "\n";
+    }
+
+    // Test 3: Adding a variant re-resolves
+    total++;
+    kernel.setVariant(Exs_DispatchTarget::SSE2, &Exs_SSE2Kernel);
+    Exs_DispatchTarget expected = descriptor.hasSSE2 ? Exs_DispatchTarget::SSE2 : Exs_DispatchTarget::Scalar;
+    if (kernel.selectedTarget() == expected && kernel(10) == (descriptor.hasSSE2 ? 12 : 11)) {
+        std::cout << "✓ Re-resolved to " << Exs_GetDispatchTargetName(kernel.selectedTarget()) << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Re-resolved to " << Exs_GetDispatchTargetName(kernel.selectedTarget()) << "\n";
+    }
+
+    // Test 4: The registry reports the kernel with its variants
+    total++;
+    bool listed = false;
+    for (const Exs_DispatchEntry& entry : Exs_GetDispatchEntries()) {
+        if (entry.name == "test_kernel") {
+            listed = entry.selectedTarget == expected && entry.variantMask == 0x1Bu;
+        }
+    }
+    if (listed) {
+        std::cout << "✓ Registry entry\n";
+        passed++;
+    } else {
+        std::cout << "✗ Registry entry missing or stale\n";
+    }
+
+    // Test 5: Target names
+    total++;
+    if (strcmp(Exs_GetDispatchTargetName(Exs_DispatchTarget::Scalar), "scalar") == 0 &&
+        strcmp(Exs_GetDispatchTargetName(Exs_DispatchTarget::AVX512), "avx512") == 0 &&
+        strcmp(Exs_GetDispatchTargetName(Exs_DispatchTarget::Count), "unknown") == 0) {
+        std::cout << "✓ Target names\n";
+        passed++;
+    } else {
+        std::cout << "✗ Target names\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
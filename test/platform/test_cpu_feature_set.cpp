@@ -0,0 +1,117 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include "../../src/Core/Platform/internal/CPUFeatureSet.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+static bool Exs_Resolves(std::string_view name, Exs_CPUFeature expected) {
+    Exs_CPUFeature feature = Exs_CPUFeature::Count;
+    return Exs_FindCPUFeature(name, feature) && feature == expected;
+}
+
+int main() {
+    std::cout << "=== Exs CPU Feature Set Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Every canonical name resolves to its own feature
+    total++;
+    bool canonical = true;
+    for (uint32 i = 0; i < kExs_CPUFeatureCount; i++) {
+        Exs_CPUFeature feature = static_cast<Exs_CPUFeature>(i);
+        canonical = canonical && Exs_Resolves(Exs_GetCPUFeatureName(feature), feature);
+    }
+    if (canonical) {
+        std::cout << "✓ " << kExs_CPUFeatureCount << " canonical names\n";
+        passed++;
+    } else {
+        std::cout << "✗ Canonical name lookup failed\n";
+    }
+
+    // Test 2: Aliases, including the spellings supportsFeature() accepted before
+    total++;
+    bool aliases = Exs_Resolves("SSE4.1", Exs_CPUFeature::SSE4_1) &&
+                   Exs_Resolves("SSE4.2", Exs_CPUFeature::SSE4_2) &&
+                   Exs_Resolves("AVX512", Exs_CPUFeature::AVX512F) &&
+                   Exs_Resolves("NEON", Exs_CPUFeature::ASIMD) &&
+                   Exs_Resolves("SHA_NI", Exs_CPUFeature::SHA) &&
+                   Exs_Resolves("LZCNT", Exs_CPUFeature::ABM) &&
+                   Exs_Resolves("3DNOWPREFETCH", Exs_CPUFeature::PREFETCHW) &&
+                   Exs_Resolves("PCLMUL", Exs_CPUFeature::PCLMULQDQ) &&
+                   Exs_Resolves("CONSTANT_TSC", Exs_CPUFeature::INVARIANT_TSC);
+    for (const Exs_CPUFeatureAlias& alias : kExs_CPUFeatureAliases) {
+        aliases = aliases && Exs_Resolves(alias.name, alias.feature);
+    }
+    if (aliases) {
+        std::cout << "✓ Aliases resolve\n";
+        passed++;
+    } else {
+        std::cout << "✗ Alias lookup failed\n";
+    }
+
+    // Test 3: Lookups ignore case
+    total++;
+    if (Exs_Resolves("avx2", Exs_CPUFeature::AVX2) && Exs_Resolves("Sse4.2", Exs_CPUFeature::SSE4_2) &&
+        Exs_Resolves("neon", Exs_CPUFeature::ASIMD) && Exs_Resolves("avx512_vnni", Exs_CPUFeature::AVX512_VNNI)) {
+        std::cout << "✓ Case-insensitive lookup\n";
+        passed++;
+    } else {
+        std::cout << "✗ Case-insensitive lookup failed\n";
+    }
+
+    // Test 4: Unknown names and near misses are rejected
+    total++;
+    Exs_CPUFeature unused;
+    if (!Exs_FindCPUFeature("", unused) && !Exs_FindCPUFeature("AVX3", unused) &&
+        !Exs_FindCPUFeature("SSE4", unused) && !Exs_FindCPUFeature("AVX2 ", unused) &&
+        !Exs_FindCPUFeature("NEONX", unused)) {
+        std::cout << "✓ Unknown names rejected\n";
+        passed++;
+    } else {
+        std::cout << "✗ Unknown name accepted\n";
+    }
+
+    // Test 5: The lookup also works at compile time
+    total++;
+    constexpr bool compileTime = [] {
+        Exs_CPUFeature feature = Exs_CPUFeature::Count;
+        return Exs_FindCPUFeature("sse4.1", feature) && feature == Exs_CPUFeature::SSE4_1;
+    }();
+    static_assert(compileTime, "constexpr feature lookup");
+    std::cout << "✓ Compile-time lookup\n";
+    passed++;
+
+    // Test 6: Detected features are internally consistent
+    total++;
+    const Exs_CPUFeatureSet& set = Exs_GetCPUFeatureSet();
+#if defined(__x86_64__) || defined(__i386__)
+    bool consistent = set.has(Exs_CPUFeature::SSE2) &&
+                      (!set.has(Exs_CPUFeature::AVX2) || set.has(Exs_CPUFeature::AVX)) &&
+                      (!set.has(Exs_CPUFeature::AVX) || set.has(Exs_CPUFeature::OSXSAVE)) &&
+                      (!set.has(Exs_CPUFeature::AVX512VL) || set.has(Exs_CPUFeature::AVX512F)) &&
+                      !set.has(Exs_CPUFeature::ASIMD);
+#elif defined(__aarch64__)
+    bool consistent = set.has(Exs_CPUFeature::ASIMD) && !set.has(Exs_CPUFeature::SSE2);
+#else
+    bool consistent = true;
+#endif
+    if (consistent) {
+        std::cout << "✓ Detected set is consistent\n";
+        passed++;
+    } else {
+        std::cout << "✗ Detected set is inconsistent\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/CPUInfoBase.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+int main() {
+    std::cout << "=== Exs CPU Info Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    std::unique_ptr<Exs_CPUInfoBase> info(Exs_CreateCPUInfoInstance());
+
+    // Test 1: Identification is filled in
+    total++;
+    if (info != nullptr && !info->getCPUName().empty() && !info->getCPUVendorString().empty()) {
+        std::cout << "✓ " << info->getCPUName() << " (" << info->getCPUVendorString() << ")\n";
+        passed++;
+    } else {
+        std::cout << "✗ CPU name or vendor missing\n";
+        std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+        return 1;
+    }
+
+    // Test 2: Counts agree with the online CPUs
+    total++;
+    uint32_t online = static_cast<uint32_t>(sysconf(_SC_NPROCESSORS_ONLN));
+    if (info->getLogicalCoreCount() == online && info->getPhysicalCoreCount() >= 1 &&
+        info->getPhysicalCoreCount() <= info->getLogicalCoreCount() &&
+        info->getSocketCount() >= 1 && info->getNumaNodeCount() >= 1) {
+        std::cout << "✓ " << info->getSocketCount() << " sockets, " << info->getPhysicalCoreCount()
+                  << " cores, " << info->getLogicalCoreCount() << " threads\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << info->getLogicalCoreCount() << " logical CPUs, " << online << " online\n";
+    }
+
+    // Test 3: One entry per logical CPU, each listed once
+    total++;
+    std::vector<Exs_CPUCoreInfo> cores = info->getCoreInfo();
+    std::set<uint32_t> ids;
+    for (const Exs_CPUCoreInfo& core : cores) {
+        ids.insert(core.coreId);
+    }
+    if (cores.size() == info->getLogicalCoreCount() && ids.size() == cores.size() &&
+        info->getCoreInfoById(cores[0].coreId).socketId == cores[0].socketId) {
+        std::cout << "✓ " << cores.size() << " core entries\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << cores.size() << " core entries, " << ids.size() << " distinct\n";
+    }
+
+    // Test 4: Cache sizes are consistent with the cache list
+    total++;
+    bool cachesOk = true;
+    for (const Exs_CPUCacheInfo& cache : info->getCacheInfo()) {
+        cachesOk = cachesOk && cache.level >= 1 && cache.sizeKB > 0 &&
+                   info->getCacheSize(cache.level, cache.type) == cache.sizeKB;
+    }
+    if (cachesOk && info->getCacheSize(9, "Unified") == 0) {
+        std::cout << "✓ " << info->getCacheInfo().size() << " caches\n";
+        passed++;
+    } else {
+        std::cout << "✗ Cache list and lookup disagree\n";
+    }
+
+    // Test 5: Static fields are parsed once and shared between instances
+    total++;
+    std::unique_ptr<Exs_CPUInfoBase> second(Exs_CreateCPUInfoInstance());
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10000; i++) {
+        second->getCPUName();
+        second->getSocketCount();
+    }
+    double perCall = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / 10000.0;
+    if (second->getCPUName() == info->getCPUName() && second->getCPUModel() == info->getCPUModel() && perCall < 50.0) {
+        std::cout << "✓ Cached getters, " << perCall << " us per call\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << perCall << " us per call\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
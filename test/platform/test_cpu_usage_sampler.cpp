@@ -0,0 +1,93 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <chrono>
+#include "../../src/Core/Platform/internal/CPUUsageSampler.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+static void Exs_SpinFor(std::chrono::milliseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    volatile uint64_t counter = 0;
+    while (std::chrono::steady_clock::now() < end) {
+        counter = counter + 1;
+    }
+}
+
+int main() {
+    std::cout << "=== Exs CPU Usage Sampler Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    Exs_CPUUsageSampler sampler;
+    Exs_CPUUsageSnapshot snapshot;
+
+    // Test 1: Nothing published before the second sample
+    total++;
+    sampler.sample();
+    if (!sampler.getSnapshot(snapshot)) {
+        std::cout << "✓ No snapshot after one sample\n";
+        passed++;
+    } else {
+        std::cout << "✗ Snapshot published after one sample\n";
+    }
+
+    // Test 2: A query right after priming waits out the minimum interval
+    total++;
+    bool sampled = sampler.sample(50);
+    if (sampled && sampler.getSnapshot(snapshot) && snapshot.intervalNs >= 50000000ULL) {
+        std::cout << "✓ First interval " << snapshot.intervalNs / 1000000 << " ms\n";
+        passed++;
+    } else {
+        std::cout << "✗ First interval " << snapshot.intervalNs / 1000000 << " ms\n";
+    }
+
+    // Test 3: Back-to-back queries reuse the published interval
+    total++;
+    uint64_t sequence = snapshot.sequence;
+    for (int i = 0; i < 100; i++) {
+        sampler.sample(100);
+    }
+    sampler.getSnapshot(snapshot);
+    if (snapshot.sequence == sequence && snapshot.intervalNs >= 50000000ULL) {
+        std::cout << "✓ Rapid queries kept sequence " << sequence << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Rapid queries published " << snapshot.sequence - sequence << " times\n";
+    }
+
+    // Test 4: A busy interval reads as busy
+    total++;
+    Exs_SpinFor(std::chrono::milliseconds(150));
+    sampler.sample(100);
+    sampler.getSnapshot(snapshot);
+    double sum = snapshot.total.user + snapshot.total.system + snapshot.total.idle +
+                 snapshot.total.iowait + snapshot.total.irq + snapshot.total.steal;
+    if (snapshot.sequence > sequence && snapshot.total.busy > 0.0 && sum > 99.0 && sum < 101.0) {
+        std::cout << "✓ Busy interval: " << snapshot.total.busy << "%\n";
+        passed++;
+    } else {
+        std::cout << "✗ Busy interval: " << snapshot.total.busy << "%, sum " << sum << "\n";
+    }
+
+    // Test 5: Per-CPU slots cover the CPU capacity
+    total++;
+    if (snapshot.cpus.size() == sampler.getCPUCapacity() && sampler.getCPUCapacity() > 0) {
+        std::cout << "✓ " << snapshot.cpus.size() << " CPU slots\n";
+        passed++;
+    } else {
+        std::cout << "✗ CPU slots " << snapshot.cpus.size() << "\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
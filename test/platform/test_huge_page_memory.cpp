@@ -0,0 +1,83 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cstring>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/HugePageMemory.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+int main() {
+    std::cout << "=== Exs Huge Page Memory Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Pools are ordered by page size
+    total++;
+    std::vector<Exs_HugePagePoolInfo> pools = Exs_GetHugePagePools();
+    bool ordered = true;
+    for (size_t i = 0; i < pools.size(); i++) {
+        ordered = ordered && pools[i].freePages <= pools[i].totalPages + pools[i].surplusPages;
+        ordered = ordered && (i == 0 || pools[i - 1].pageSizeBytes < pools[i].pageSizeBytes);
+    }
+    if (ordered) {
+        std::cout << "✓ " << pools.size() << " huge page pools\n";
+        passed++;
+    } else {
+        std::cout << "✗ Pools unordered or inconsistent\n";
+    }
+
+    // Test 2: An odd size is rounded up to the page size of its backing
+    total++;
+    const uint64_t requested = 3 * 1024 * 1024 + 123;
+    Exs_LargeRegion region = Exs_AllocateLargeRegion(requested);
+    uint64_t basePage = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    bool rounded = region.address != nullptr && region.backing != Exs_LargeRegionBacking::None &&
+                   region.size >= requested && region.pageSizeBytes >= basePage &&
+                   region.size % region.pageSizeBytes == 0 &&
+                   (region.backing != Exs_LargeRegionBacking::BasePages || region.pageSizeBytes == basePage);
+    if (rounded) {
+        std::cout << "✓ " << region.size << " bytes mapped with " << region.pageSizeBytes << "-byte pages\n";
+        passed++;
+    } else {
+        std::cout << "✗ Region size " << region.size << ", page " << region.pageSizeBytes << "\n";
+    }
+
+    // Test 3: Touched memory shows up as resident
+    total++;
+    if (region.address != nullptr) {
+        memset(region.address, 1, region.size);
+    }
+    Exs_LargeRegionResidency residency = Exs_GetLargeRegionResidency(region);
+    if (residency.residentBytes >= requested && residency.hugePageBytes <= residency.residentBytes &&
+        residency.hugePageFraction >= 0.0 && residency.hugePageFraction <= 1.0) {
+        std::cout << "✓ Resident " << residency.residentBytes << " bytes, "
+                  << residency.hugePageFraction * 100.0 << "% huge\n";
+        passed++;
+    } else {
+        std::cout << "✗ Residency " << residency.residentBytes << " bytes\n";
+    }
+
+    // Test 4: Freeing clears the region
+    total++;
+    Exs_FreeLargeRegion(region);
+    if (region.address == nullptr && region.size == 0 && region.backing == Exs_LargeRegionBacking::None &&
+        Exs_GetLargeRegionResidency(region).residentBytes == 0) {
+        std::cout << "✓ Region released\n";
+        passed++;
+    } else {
+        std::cout << "✗ Region not cleared\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cstring>
+#include "../../src/Core/Platform/internal/MemInfoReader.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+static bool Exs_Parse(const char* text, Exs_MemInfoValues& values, uint8_t* hints = nullptr, uint32_t hintCount = 0) {
+    return Exs_ParseMemInfo(text, strlen(text), values, hints, hintCount);
+}
+
+int main() {
+    std::cout << "=== Exs MemInfo Reader Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: kB values become bytes, page counts stay counts, unknown keys are ignored
+    total++;
+    const char* meminfo =
+        "MemTotal:       16384000 kB\n"
+        "MemFree:         1024000 kB\n"
+        "Zswap:                 0 kB\n"
+        "HugePages_Total:      16\n"
+        "Hugepagesize:       2048 kB";
+    Exs_MemInfoValues values;
+    bool parsed = Exs_Parse(meminfo, values);
+    if (parsed && values.get(Exs_MemInfoField::MemTotal) == 16384000ULL * 1024 &&
+        values.get(Exs_MemInfoField::MemFree) == 1024000ULL * 1024 &&
+        values.get(Exs_MemInfoField::HugePages_Total) == 16 &&
+        values.get(Exs_MemInfoField::Hugepagesize) == 2048ULL * 1024 &&
+        values.has(Exs_MemInfoField::MemTotal) && !values.has(Exs_MemInfoField::MemAvailable)) {
+        std::cout << "✓ /proc/meminfo layout\n";
+        passed++;
+    } else {
+        std::cout << "✗ /proc/meminfo layout misparsed\n";
+    }
+
+    // Test 2: Per-node files drop the "Node N" prefix
+    total++;
+    const char* nodeInfo =
+        "Node 12 MemTotal:       8192 kB\n"
+        "Node 12 MemUsed:        4096 kB\n";
+    if (Exs_Parse(nodeInfo, values) && values.get(Exs_MemInfoField::MemTotal) == 8192ULL * 1024 &&
+        values.get(Exs_MemInfoField::MemUsed) == 4096ULL * 1024) {
+        std::cout << "✓ Node meminfo layout\n";
+        passed++;
+    } else {
+        std::cout << "✗ Node meminfo layout misparsed\n";
+    }
+
+    // Test 3: Line hints are learned and survive a changed layout, including
+    // a kept key moving onto a line that used to be skipped
+    total++;
+    uint8_t hints[8] = {};
+    Exs_MemInfoValues first;
+    Exs_MemInfoValues again;
+    Exs_MemInfoValues shifted;
+    const char* reordered =
+        "MemFree:            2 kB\n"
+        "MemTotal:           4 kB\n"
+        "Dirty:              1 kB\n"
+        "HugePages_Total:    3\n";
+    bool hinted = Exs_Parse(meminfo, first, hints, 8) && Exs_Parse(meminfo, again, hints, 8) &&
+                  Exs_Parse(reordered, shifted, hints, 8);
+    if (hinted && memcmp(&first, &again, sizeof(first)) == 0 &&
+        first.get(Exs_MemInfoField::MemTotal) == 16384000ULL * 1024 &&
+        shifted.get(Exs_MemInfoField::MemFree) == 2048 && shifted.get(Exs_MemInfoField::MemTotal) == 4096 &&
+        shifted.get(Exs_MemInfoField::Dirty) == 1024 && shifted.get(Exs_MemInfoField::HugePages_Total) == 3) {
+        std::cout << "✓ Line hints\n";
+        passed++;
+    } else {
+        std::cout << "✗ Line hints returned stale fields\n";
+    }
+
+    // Test 4: Nothing known is a failed parse
+    total++;
+    if (!Exs_Parse("", values) && !Exs_Parse("Zswap: 1 kB\n", values) && values.present == 0) {
+        std::cout << "✓ Empty input rejected\n";
+        passed++;
+    } else {
+        std::cout << "✗ Empty input accepted\n";
+    }
+
+    // Test 5: The reader serves repeated queries from its cache
+    total++;
+    Exs_MemInfoReader reader("/proc/meminfo", 60000);
+    Exs_MemInfoReader missing("/proc/does-not-exist");
+    Exs_MemInfoValues cachedA;
+    Exs_MemInfoValues cachedB;
+    if (reader.isOpen() && reader.read(cachedA) && reader.read(cachedB) &&
+        memcmp(&cachedA, &cachedB, sizeof(cachedA)) == 0 && cachedA.get(Exs_MemInfoField::MemTotal) > 0 &&
+        !missing.isOpen() && !missing.read(cachedA)) {
+        std::cout << "✓ MemTotal " << cachedB.get(Exs_MemInfoField::MemTotal) / (1024 * 1024) << " MB, cached\n";
+        passed++;
+    } else {
+        std::cout << "✗ Reader failed or re-read inside the window\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
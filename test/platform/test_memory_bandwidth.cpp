@@ -0,0 +1,73 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include "../../src/Core/Platform/internal/MemoryBandwidth.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+int main() {
+    std::cout << "=== Exs Memory Bandwidth Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Small arrays keep the run short; the numbers are cache bandwidth then
+    Exs_StreamOptions options;
+    options.arrayBytes = 8 * 1024 * 1024 + 100;
+    options.repetitions = 3;
+    options.perNode = true;
+    Exs_StreamReport report = Exs_MeasureMemoryBandwidth(options);
+
+    // Test 1: Options are echoed and the array size is whole cache lines
+    total++;
+    if (report.arrayBytes % 64 == 0 && report.arrayBytes <= options.arrayBytes &&
+        report.arrayBytes + 64 > options.arrayBytes && report.repetitions == 3 && report.nonTemporalStores) {
+        std::cout << "✓ " << report.arrayBytes << " bytes per array, "
+                  << Exs::Internal::Platform::Exs_GetDispatchTargetName(report.target) << " kernels\n";
+        passed++;
+    } else {
+        std::cout << "✗ Array size " << report.arrayBytes << "\n";
+    }
+
+    // Test 2: Every kernel of the system run reports consistent statistics
+    total++;
+    bool consistent = report.system.node == kExs_StreamAllNodes && report.system.threads >= 1 &&
+                      report.system.cpus.size() == report.system.threads;
+    for (uint32_t i = 0; i < kExs_StreamKernelCount; i++) {
+        const Exs_StreamKernelResult& kernel = report.system.kernels[i];
+        consistent = consistent && kernel.bestGBps > 0.0 && kernel.bestSeconds > 0.0 &&
+                     kernel.meanGBps > 0.0 && kernel.meanGBps <= kernel.bestGBps * 1.0001 &&
+                     kernel.stddevGBps >= 0.0;
+    }
+    if (consistent) {
+        std::cout << "✓ Triad " << report.system.get(Exs_StreamKernel::Triad).bestGBps << " GB/s on "
+                  << report.system.threads << " threads\n";
+        passed++;
+    } else {
+        std::cout << "✗ System run incomplete\n";
+    }
+
+    // Test 3: Per-node runs cover the system CPUs
+    total++;
+    uint32_t nodeThreads = 0;
+    for (const Exs_StreamRunResult& node : report.nodes) {
+        nodeThreads += node.threads;
+    }
+    if (!report.nodes.empty() && nodeThreads == report.system.threads) {
+        std::cout << "✓ " << report.nodes.size() << " node runs\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << report.nodes.size() << " node runs with " << nodeThreads << " threads\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
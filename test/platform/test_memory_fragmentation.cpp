@@ -0,0 +1,100 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cmath>
+#include "../../src/Core/Platform/internal/MemoryFragmentation.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+static bool Exs_Near(double value, double expected) {
+    return std::fabs(value - expected) < 1e-9;
+}
+
+int main() {
+    std::cout << "=== Exs Memory Fragmentation Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // 4 KB pages, 2 MB huge pages (order 9), eleven orders per zone
+    const char* buddyInfo =
+        "Node 0, zone      DMA      0      0      0      0      0      0      0      0      0      0      0\n"
+        "Node 0, zone    DMA32      4      0      0      0      0      0      0      0      0      2      1\n"
+        "Node 1, zone   Normal    100     50      0      0      0      0      0      0      0      0      0\n";
+    Exs_FragmentationReport report = {};
+    report.pageSizeBytes = 4096;
+    report.hugePageOrder = 9;
+    bool parsed = Exs_ParseFragmentationReport(buddyInfo, nullptr, report);
+
+    // Test 1: Zones and their free lists
+    total++;
+    if (parsed && report.zones.size() == 3 && report.zones[1].zone == "DMA32" && report.zones[2].node == 1 &&
+        report.zones[1].freeBlocks.size() == 11 && report.zones[1].freePages == 2052 &&
+        report.zones[1].largestFreeBlockBytes == 4096ULL << 10 && report.zones[1].hugePageBlocks == 4) {
+        std::cout << "✓ " << report.zones.size() << " zones parsed\n";
+        passed++;
+    } else {
+        std::cout << "✗ buddyinfo misparsed\n";
+    }
+
+    // Test 2: Indices computed as mm/vmstat.c does
+    total++;
+    const Exs_BuddyZoneInfo& empty = report.zones[0];
+    const Exs_BuddyZoneInfo& healthy = report.zones[1];
+    const Exs_BuddyZoneInfo& fragmented = report.zones[2];
+    if (empty.unusableIndex == 1.0 && empty.extfragIndex == 0.0 && empty.largestFreeBlockBytes == 0 &&
+        Exs_Near(healthy.unusableIndex, 4.0 / 2052.0) && healthy.extfragIndex == -1.0 &&
+        fragmented.unusableIndex == 1.0 && Exs_Near(fragmented.extfragIndex, 0.991) &&
+        !fragmented.extfragFromKernel) {
+        std::cout << "✓ Unusable and extfrag indices\n";
+        passed++;
+    } else {
+        std::cout << "✗ Indices " << healthy.unusableIndex << ", " << fragmented.extfragIndex << "\n";
+    }
+
+    // Test 3: The total sums every zone
+    total++;
+    if (report.total.freePages == 2252 && report.total.hugePageBlocks == 4 &&
+        report.total.freeBlocks[0] == 104 && report.total.extfragIndex == -1.0) {
+        std::cout << "✓ Total " << report.total.freePages << " free pages\n";
+        passed++;
+    } else {
+        std::cout << "✗ Total " << report.total.freePages << " free pages\n";
+    }
+
+    // Test 4: The kernel's extfrag_index replaces the computed one for its zone
+    total++;
+    const char* extfrag =
+        "Node 1, zone   Normal -1.000 -1.000 0.100 0.200 0.300 0.400 0.500 0.600 0.700 0.850 0.900\n";
+    bool kernelParsed = Exs_ParseFragmentationReport(buddyInfo, extfrag, report);
+    if (kernelParsed && report.zones.size() == 3 && report.zones[2].extfragFromKernel &&
+        report.zones[2].extfragIndex == 0.85 && !report.zones[1].extfragFromKernel) {
+        std::cout << "✓ Kernel extfrag_index used\n";
+        passed++;
+    } else {
+        std::cout << "✗ Kernel extfrag_index ignored\n";
+    }
+
+    // Test 5: Nothing parsable is a failure; the live report has zones
+    total++;
+    Exs_FragmentationReport live;
+    if (!Exs_ParseFragmentationReport("", nullptr, report) && Exs_GetFragmentationReport(live) &&
+        !live.zones.empty() && live.pageSizeBytes > 0 && live.hugePageOrder > 0) {
+        std::cout << "✓ Live report: " << live.zones.size() << " zones, "
+                  << live.total.unusableIndex * 100.0 << "% unusable for order " << live.hugePageOrder << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Empty input accepted or no live report\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
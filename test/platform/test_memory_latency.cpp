@@ -0,0 +1,90 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include "../../src/Core/Platform/internal/MemoryLatency.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+static bool Exs_LevelIs(const Exs_LatencyLevel& level, uint32_t id, uint64_t capacity, double nanoseconds) {
+    return level.level == id && level.capacityBytes == capacity && level.nanoseconds == nanoseconds;
+}
+
+int main() {
+    std::cout << "=== Exs Memory Latency Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Two caches and memory, with a lone transition point dropped
+    total++;
+    std::vector<Exs_LatencyPoint> curve = {
+        { 4096, 1.0 }, { 8192, 1.1 }, { 16384, 0.9 }, { 32768, 1.2 },
+        { 65536, 2.5 },
+        { 131072, 4.0 }, { 262144, 4.4 }, { 524288, 4.2 },
+        { 1048576, 80.0 }, { 2097152, 85.0 }, { 4194304, 90.0 } };
+    std::vector<Exs_LatencyLevel> levels = Exs_InferLatencyLevels(curve);
+    if (levels.size() == 3 && Exs_LevelIs(levels[0], 1, 32768, 1.1) &&
+        Exs_LevelIs(levels[1], 2, 524288, 4.2) && Exs_LevelIs(levels[2], kExs_LatencyMemoryLevel, 0, 85.0)) {
+        std::cout << "✓ L1, L2 and memory plateaus\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << levels.size() << " levels inferred\n";
+    }
+
+    // Test 2: A lone point at the end of the sweep still counts as memory
+    total++;
+    levels = Exs_InferLatencyLevels({ { 4096, 1.0 }, { 8192, 1.0 }, { 16384, 60.0 } });
+    if (levels.size() == 2 && Exs_LevelIs(levels[0], 1, 8192, 1.0) &&
+        Exs_LevelIs(levels[1], kExs_LatencyMemoryLevel, 0, 60.0)) {
+        std::cout << "✓ Trailing point kept\n";
+        passed++;
+    } else {
+        std::cout << "✗ Trailing point dropped\n";
+    }
+
+    // Test 3: A flat curve is one cache level, an empty one has none
+    total++;
+    levels = Exs_InferLatencyLevels({ { 4096, 1.0 }, { 8192, 1.1 } });
+    if (levels.size() == 1 && Exs_LevelIs(levels[0], 1, 8192, 1.1) && Exs_InferLatencyLevels({}).empty()) {
+        std::cout << "✓ Flat and empty curves\n";
+        passed++;
+    } else {
+        std::cout << "✗ Flat or empty curve misread\n";
+    }
+
+    // Test 4: A short local sweep yields an ascending curve with levels
+    total++;
+    Exs_LatencyOptions options;
+    options.maxBytes = 1024 * 1024;
+    options.stepsPerOctave = 1;
+    options.loadsPerPoint = 1 << 16;
+    options.hugePages = false;
+    options.remoteNodes = false;
+    Exs_LatencyReport report = Exs_MeasureMemoryLatency(options);
+    bool ascending = !report.curves.empty() && !report.curves[0].points.empty() &&
+                     !report.curves[0].levels.empty();
+    for (const Exs_LatencyCurve& measured : report.curves) {
+        for (size_t i = 0; i < measured.points.size(); i++) {
+            ascending = ascending && measured.points[i].nanoseconds > 0.0 &&
+                        (i == 0 || measured.points[i - 1].workingSetBytes < measured.points[i].workingSetBytes);
+        }
+    }
+    if (ascending) {
+        std::cout << "✓ " << report.curves[0].points.size() << " points, "
+                  << report.curves[0].levels.size() << " levels\n";
+        passed++;
+    } else {
+        std::cout << "✗ No usable curve\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
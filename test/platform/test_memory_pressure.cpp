@@ -0,0 +1,65 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <memory>
+#include "../../src/Core/Platform/internal/MemoryPressure.h"
+#include "../../src/Core/Platform/internal/MemoryInfoBase.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+int main() {
+    std::cout << "=== Exs Memory Pressure Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Both lines of a memory.pressure file
+    total++;
+    Exs_MemoryPressure pressure;
+    bool parsed = Exs_ParseMemoryPressure("some avg10=1.25 avg60=0.50 avg300=0.10 total=123456\n"
+                                          "full avg10=0.75 avg60=0.25 avg300=0.05 total=6543\n", pressure);
+    if (parsed && pressure.some.avg10 == 1.25 && pressure.some.avg300 == 0.10 &&
+        pressure.some.totalMicroseconds == 123456 && pressure.full.avg60 == 0.25 &&
+        pressure.full.totalMicroseconds == 6543) {
+        std::cout << "✓ some and full parsed\n";
+        passed++;
+    } else {
+        std::cout << "✗ Pressure file parsed incorrectly\n";
+    }
+
+    // Test 2: "full" is optional, "some" is not
+    total++;
+    bool someOnly = Exs_ParseMemoryPressure("some avg10=3.00 avg60=2.00 avg300=1.00 total=42", pressure);
+    bool fullOnly = Exs_ParseMemoryPressure("full avg10=3.00 avg60=2.00 avg300=1.00 total=42\n", pressure);
+    if (someOnly && !fullOnly && !Exs_ParseMemoryPressure("", pressure)) {
+        std::cout << "✓ Missing lines handled\n";
+        passed++;
+    } else {
+        std::cout << "✗ Missing lines mishandled\n";
+    }
+
+    // Test 3: The percentage is the stall share, or the sentinel without PSI
+    total++;
+    std::unique_ptr<Exs_MemoryInfoBase> info(Exs_CreateMemoryInfoInstance());
+    bool havePSI = Exs_ReadMemoryPressure(Exs_PressureSource::Cgroup, pressure) ||
+                   Exs_ReadMemoryPressure(Exs_PressureSource::System, pressure);
+    double percentage = info->getMemoryPressurePercentage();
+    bool expected = havePSI ? percentage >= 0.0 && percentage <= 100.0 : percentage == kExs_PressureUnavailable;
+    if (expected) {
+        std::cout << "✓ Pressure " << (havePSI ? "from PSI: " : "unavailable: ") << percentage << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Pressure percentage " << percentage << "\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/NumaMemory.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+int main() {
+    std::cout << "=== Exs NUMA Memory Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    uint64_t basePage = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    int currentCPU = sched_getcpu();
+    uint32_t cpu = currentCPU >= 0 ? static_cast<uint32_t>(currentCPU) : 0;
+
+    // Test 1: Nodes are listed in id order and cover the running CPU
+    total++;
+    std::vector<Exs_NumaNodeInfo> nodes = Exs_GetNumaNodes();
+    std::vector<uint32_t> memoryNodes = Exs_GetNumaMemoryNodes();
+    bool ordered = !nodes.empty() && !memoryNodes.empty();
+    bool cpuListed = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ordered = ordered && (i == 0 || nodes[i - 1].node < nodes[i].node) && nodes[i].freeBytes <= nodes[i].totalBytes;
+        cpuListed = cpuListed || (nodes[i].node == Exs_GetNumaNodeOfCPU(cpu) &&
+                                  std::find(nodes[i].cpus.begin(), nodes[i].cpus.end(), cpu) != nodes[i].cpus.end());
+    }
+    if (ordered && cpuListed) {
+        std::cout << "✓ " << nodes.size() << " nodes, " << memoryNodes.size() << " with memory\n";
+        passed++;
+    } else {
+        std::cout << "✗ Node list inconsistent\n";
+    }
+
+    // Test 2: A range smaller than the CPU list is still touched
+    total++;
+    char* mapping = static_cast<char*>(mmap(nullptr, basePage * 8, PROT_READ | PROT_WRITE,
+                                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    Exs_FirstTouchPartitioned(mapping, 2, { cpu, cpu, cpu, cpu });
+    Exs_NumaPlacement placement = Exs_GetNumaPlacement(mapping, 1);
+    if (placement.sampledPages == 1 && placement.unmappedPages == 0) {
+        std::cout << "✓ Two bytes over four CPUs faulted in\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << placement.unmappedPages << " of " << placement.sampledPages << " pages untouched\n";
+    }
+
+    // Test 3: An unaligned range touches every page it overlaps and keeps the contents
+    total++;
+    char* unaligned = mapping + 2 * basePage + 100;
+    unaligned[basePage] = 7;
+    Exs_FirstTouchPartitioned(unaligned, 3 * basePage, { cpu, cpu, cpu, cpu, cpu });
+    placement = Exs_GetNumaPlacement(unaligned, 3 * basePage);
+    if (placement.sampledPages == 4 && placement.unmappedPages == 0 && unaligned[basePage] == 7 &&
+        Exs_GetNumaPlacement(mapping + 6 * basePage, 2 * basePage).unmappedPages == 2) {
+        std::cout << "✓ Unaligned range touched page by page\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << placement.unmappedPages << " of " << placement.sampledPages << " pages untouched\n";
+    }
+    munmap(mapping, basePage * 8);
+
+    // Test 4: Slices follow the page size of a large region
+    total++;
+    Exs_LargeRegion region = Exs_AllocateOnNode(8 * 1024 * 1024, memoryNodes[0]);
+    if (region.address != nullptr) {
+        Exs_FirstTouchPartitioned(region.address, region.size, { cpu, cpu, cpu }, region.pageSizeBytes);
+        placement = Exs_GetNumaPlacement(region.address, region.size, region.pageSizeBytes);
+    }
+    if (region.address != nullptr && placement.unmappedPages == 0 &&
+        placement.sampledPages == region.size / region.pageSizeBytes &&
+        placement.getNodeFraction(memoryNodes[0]) == 1.0) {
+        std::cout << "✓ " << placement.sampledPages << " pages of " << region.pageSizeBytes
+                  << " bytes on node " << memoryNodes[0] << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Large region placement " << placement.unmappedPages << " untouched\n";
+    }
+    Exs_FreeLargeRegion(region);
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <memory>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/PlatformDescriptor.h"
+#include "../../src/Core/Platform/internal/CPUFeatureSet.h"
+
+using namespace Exs::Internal::Platform;
+using Exs::Internal::CPUInfo::Exs_CPUFeature;
+using Exs::Internal::CPUInfo::Exs_GetCPUFeatureSet;
+
+int main() {
+    std::cout << "=== Exs Platform Descriptor Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    const Exs_PlatformDescriptor& descriptor = Exs_GetPlatformDescriptor();
+
+    // Test 1: Built once; every call returns the same object
+    total++;
+    if (&descriptor == &Exs_GetPlatformDescriptor()) {
+        std::cout << "✓ Single descriptor instance\n";
+        passed++;
+    } else {
+        std::cout << "✗ Descriptor rebuilt\n";
+    }
+
+    // Test 2: Compile-time facts and memory geometry
+    total++;
+    bool pageOk = descriptor.pageSize == static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+    bool lineOk = descriptor.cacheLineSize >= 16 && (descriptor.cacheLineSize & (descriptor.cacheLineSize - 1)) == 0;
+    if (descriptor.architecture == Exs_CompileTimeArchitecture() &&
+        descriptor.endianness == Exs_CompileTimeEndianness() && pageOk && lineOk) {
+        std::cout << "✓ Page " << descriptor.pageSize << " B, line " << descriptor.cacheLineSize << " B\n";
+        passed++;
+    } else {
+        std::cout << "✗ Page " << descriptor.pageSize << " B, line " << descriptor.cacheLineSize << " B\n";
+    }
+
+    // Test 3: Core counts are plausible
+    total++;
+    if (descriptor.logicalCoreCount >= 1 && descriptor.physicalCoreCount >= 1 &&
+        descriptor.physicalCoreCount <= descriptor.logicalCoreCount) {
+        std::cout << "✓ " << descriptor.physicalCoreCount << " physical / "
+                  << descriptor.logicalCoreCount << " logical cores\n";
+        passed++;
+    } else {
+        std::cout << "✗ Core counts " << descriptor.physicalCoreCount << "/" << descriptor.logicalCoreCount << "\n";
+    }
+
+    // Test 4: SIMD flags agree with the CPU feature set
+    total++;
+    const auto& features = Exs_GetCPUFeatureSet();
+    if (descriptor.hasSSE2 == features.has(Exs_CPUFeature::SSE2) &&
+        descriptor.hasAVX == features.has(Exs_CPUFeature::AVX) &&
+        descriptor.hasAVX2 == features.has(Exs_CPUFeature::AVX2) &&
+        descriptor.hasAVX512F == features.has(Exs_CPUFeature::AVX512F) &&
+        descriptor.hasNEON == features.has(Exs_CPUFeature::ASIMD) &&
+        (!descriptor.hasAVX2 || descriptor.hasAVX)) {
+        std::cout << "✓ SIMD flags match the feature set\n";
+        passed++;
+    } else {
+        std::cout << "✗ SIMD flags disagree with the feature set\n";
+    }
+
+    // Test 5: The platform instance answers from the descriptor
+    total++;
+    std::unique_ptr<Exs_PlatformBase> platform(Exs_CreatePlatformInstance());
+    if (platform->getMemoryPageSize() == descriptor.pageSize &&
+        platform->getArchitecture() == descriptor.architecture &&
+        platform->supportsAVX() == descriptor.hasAVX) {
+        std::cout << "✓ Platform instance uses the descriptor\n";
+        passed++;
+    } else {
+        std::cout << "✗ Platform instance disagrees with the descriptor\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
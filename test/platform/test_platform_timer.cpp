@@ -0,0 +1,73 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/PlatformBase.h"
+
+using namespace Exs::Internal::Platform;
+
+int main() {
+    std::cout << "=== Exs Platform Timer Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    std::unique_ptr<Exs_PlatformBase> platform(Exs_CreatePlatformInstance());
+
+    // Test 1: The timer never runs backwards
+    total++;
+    uint64_t previous = platform->getHighResolutionTimer();
+    bool monotonic = true;
+    for (int i = 0; i < 100000; i++) {
+        uint64_t now = platform->getHighResolutionTimer();
+        monotonic = monotonic && now >= previous;
+        previous = now;
+    }
+    if (monotonic) {
+        std::cout << "✓ Timer is monotonic\n";
+        passed++;
+    } else {
+        std::cout << "✗ Timer went backwards\n";
+    }
+
+    // Test 2: Ticks divided by the frequency track wall time
+    total++;
+    double frequency = platform->getHighResolutionTimerFrequency();
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t start = platform->getHighResolutionTimer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    uint64_t end = platform->getHighResolutionTimer();
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double measured = frequency > 0.0 ? static_cast<double>(end - start) / frequency : 0.0;
+    if (frequency > 0.0 && measured > wall * 0.95 && measured < wall * 1.05) {
+        std::cout << "✓ " << measured * 1000.0 << " ms measured for " << wall * 1000.0
+                  << " ms at " << frequency / 1e6 << " MHz\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << measured * 1000.0 << " ms measured for " << wall * 1000.0 << " ms\n";
+    }
+
+    // Test 3: Process and thread ids come from the kernel
+    total++;
+    if (platform->getCurrentProcessId() == static_cast<uint32_t>(getpid()) && platform->getCurrentThreadId() != 0) {
+        std::cout << "✓ Process " << platform->getCurrentProcessId() << ", thread "
+                  << platform->getCurrentThreadId() << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Process or thread id wrong\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
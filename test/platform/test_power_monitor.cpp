@@ -0,0 +1,117 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cmath>
+#include "../../src/Core/Platform/internal/PowerCap.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+static bool Exs_Near(double value, double expected) {
+    return std::fabs(value - expected) < 1e-6;
+}
+
+int main() {
+    std::cout << "=== Exs Power Monitor Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Counter deltas, with and without a wrap
+    total++;
+    uint64 powercapRange = 262143328850ULL + 1; // max_energy_range_uj + 1
+    bool plain = Exs_EnergyCounterDelta(1000, 1500, powercapRange) == 500;
+    bool powercapWrap = Exs_EnergyCounterDelta(powercapRange - 100, 50, powercapRange) == 150;
+    bool msrWrap = Exs_EnergyCounterDelta(0xFFFFFFF0ULL, 0x10, 1ULL << 32) == 0x20;
+    if (plain && powercapWrap && msrWrap) {
+        std::cout << "✓ Counter deltas across wraps\n";
+        passed++;
+    } else {
+        std::cout << "✗ Counter deltas wrong (plain " << plain << ", powercap " << powercapWrap
+                  << ", MSR " << msrWrap << ")\n";
+    }
+
+    // Test 2: Fewer than two samples give no power
+    total++;
+    Exs_EnergyHistory history;
+    bool emptyZero = history.getWatts(1000000000ULL) == 0.0;
+    history.add(0, 0.0, 1000000000ULL);
+    if (emptyZero && history.getWatts(1000000000ULL) == 0.0) {
+        std::cout << "✓ No power before the first interval\n";
+        passed++;
+    } else {
+        std::cout << "✗ Power reported from a single sample\n";
+    }
+
+    // Test 3: A 10 s window at 10 Hz spans the whole window, not a fixed sample count
+    total++;
+    uint64 windowNs = 10000000000ULL;
+    Exs_EnergyHistory longWindow;
+    for (uint64 i = 0; i <= 200; i++) {
+        // 10 W for 10 s, then 20 W for 10 s
+        uint64 timeNs = i * 100000000ULL;
+        double energy = i <= 100 ? i * 1e6 : 100e6 + (i - 100) * 2e6;
+        longWindow.add(timeNs, energy, windowNs);
+    }
+    double windowWatts = longWindow.getWatts(windowNs);
+    if (Exs_Near(windowWatts, 20.0) && longWindow.size() == 101) {
+        std::cout << "✓ 10 s window holds " << longWindow.size() << " samples at " << windowWatts << " W\n";
+        passed++;
+    } else {
+        std::cout << "✗ 10 s window holds " << longWindow.size() << " samples at " << windowWatts << " W\n";
+    }
+
+    // Test 4: The average covers the window; a shorter window sees the newer power
+    total++;
+    Exs_EnergyHistory mixed;
+    for (uint64 i = 0; i <= 20; i++) {
+        // 10 W for 1 s, then 20 W for 1 s
+        double energy = i <= 10 ? i * 1e6 : 10e6 + (i - 10) * 2e6;
+        mixed.add(i * 100000000ULL, energy, 2000000000ULL);
+    }
+    double twoSeconds = mixed.getWatts(2000000000ULL);
+    double oneSecond = mixed.getWatts(1000000000ULL);
+    if (Exs_Near(twoSeconds, 15.0) && Exs_Near(oneSecond, 20.0)) {
+        std::cout << "✓ Window averages " << twoSeconds << " W over 2 s, " << oneSecond << " W over 1 s\n";
+        passed++;
+    } else {
+        std::cout << "✗ Window averages " << twoSeconds << " W over 2 s, " << oneSecond << " W over 1 s\n";
+    }
+
+    // Test 5: Samples older than the window are dropped, keeping one at the edge
+    total++;
+    Exs_EnergyHistory trimmed;
+    for (uint64 i = 0; i <= 100; i++) {
+        trimmed.add(i * 100000000ULL, i * 1e6, 1000000000ULL);
+    }
+    if (trimmed.size() == 11 && Exs_Near(trimmed.getWatts(1000000000ULL), 10.0)) {
+        std::cout << "✓ History trimmed to " << trimmed.size() << " samples\n";
+        passed++;
+    } else {
+        std::cout << "✗ History kept " << trimmed.size() << " samples\n";
+    }
+
+    // Test 6: Sampling reports intervals exactly when a source exists
+    total++;
+    Exs_PowerMonitor monitor;
+    bool haveSource = monitor.getSource() != Exs_PowerSource::None;
+    monitor.sample();
+    monitor.sample(10);
+    if (monitor.hasInterval() == haveSource && monitor.getPackagePowerWatts() >= 0.0 &&
+        monitor.getDomains().empty() != haveSource) {
+        std::cout << "✓ " << monitor.getDomains().size() << " power domains\n";
+        passed++;
+    } else {
+        std::cout << "✗ Monitor state does not match its source\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
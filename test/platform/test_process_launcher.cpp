@@ -0,0 +1,96 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <string>
+#include "../../src/Core/Platform/internal/ProcessLauncher.h"
+
+using namespace Exs::Internal::Platform;
+
+int main() {
+    std::cout << "=== Exs Process Launcher Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: Output and exit code
+    total++;
+    std::string output;
+    Exs_ProcessResult result = Exs_RunShellCommand("echo hello; exit 3", 5000, &output);
+    if (result.launched && result.exited && result.exitCode == 3 && !result.timedOut &&
+        output == "hello\n") {
+        std::cout << "✓ Exit code and stdout captured\n";
+        passed++;
+    } else {
+        std::cout << "✗ Exit code " << result.exitCode << ", output \"" << output << "\"\n";
+    }
+
+    // Test 2: The deadline covers a child that closed its output
+    total++;
+    result = Exs_RunShellCommand("exec >/dev/null 2>&1; sleep 3", 300);
+    if (result.timedOut && result.termSignal == 9 && result.wallTimeUs < 2000000) {
+        std::cout << "✓ Silent child killed after " << result.wallTimeUs / 1000 << " ms\n";
+        passed++;
+    } else {
+        std::cout << "✗ Silent child: timedOut " << result.timedOut << " after "
+                  << result.wallTimeUs / 1000 << " ms\n";
+    }
+
+    // Test 3: A background grandchild holding the pipe does not delay us
+    total++;
+    result = Exs_RunShellCommand("(sleep 3 &); exit 0", 2000);
+    if (!result.timedOut && result.exited && result.exitCode == 0 && result.wallTimeUs < 1000000) {
+        std::cout << "✓ Returned after " << result.wallTimeUs / 1000 << " ms despite grandchild\n";
+        passed++;
+    } else {
+        std::cout << "✗ Grandchild: timedOut " << result.timedOut << " after "
+                  << result.wallTimeUs / 1000 << " ms\n";
+    }
+
+    // Test 4: A chatty child is still killed on time
+    total++;
+    result = Exs_RunShellCommand("yes", 300);
+    if (result.timedOut && result.wallTimeUs < 2000000) {
+        std::cout << "✓ Busy writer killed after " << result.wallTimeUs / 1000 << " ms\n";
+        passed++;
+    } else {
+        std::cout << "✗ Busy writer: timedOut " << result.timedOut << "\n";
+    }
+
+    // Test 5: stderr captured separately unless inherited
+    total++;
+    std::string errors;
+    Exs_ProcessOptions options;
+    options.arguments = { "/bin/sh", "-c", "echo out; echo err >&2" };
+    options.timeoutMs = 5000;
+    options.onStderr = [&errors](const char* data, size_t size) { errors.append(data, size); };
+    result = Exs_RunProcess(options);
+    if (result.exited && errors == "err\n") {
+        std::cout << "✓ stderr captured\n";
+        passed++;
+    } else {
+        std::cout << "✗ stderr: \"" << errors << "\"\n";
+    }
+
+    // Test 6: Missing program
+    total++;
+    options = {};
+    options.arguments = { "/nonexistent/exs-test-binary" };
+    result = Exs_RunProcess(options);
+    if (!result.launched || (result.exited && result.exitCode == 127)) {
+        std::cout << "✓ Missing program reported\n";
+        passed++;
+    } else {
+        std::cout << "✗ Missing program launched\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
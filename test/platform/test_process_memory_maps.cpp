@@ -0,0 +1,136 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/ProcessMemoryMaps.h"
+
+using namespace Exs::Internal::MemoryInfo;
+
+static bool Exs_WriteFile(const char* path, const std::string& text) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    bool ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+    return fclose(file) == 0 && ok;
+}
+
+int main() {
+    std::cout << "=== Exs Process Memory Maps Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    char path[] = "/tmp/exs_smaps_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd >= 0) {
+        close(fd);
+    }
+
+    // Test 1: Header fields and counters of an smaps mapping
+    total++;
+    std::string smaps =
+        "00400000-00452000 r-xp 00001000 08:02 173521                     /usr/lib/my lib.so\n"
+        "Size:                328 kB\n"
+        "KernelPageSize:        4 kB\n"
+        "Rss:                 300 kB\n"
+        "Pss:                 150 kB\n"
+        "Shared_Clean:        200 kB\n"
+        "Private_Dirty:       100 kB\n"
+        "Shared_Hugetlb:     2048 kB\n"
+        "Private_Hugetlb:    2048 kB\n"
+        "VmFlags: rd ex mr mw me dw\n"
+        "7ffd1000-7ffd2000 rw-p 00000000 00:00 0                          [stack]\n"
+        "Rss:                   4 kB\n"
+        "Anonymous:             4 kB";
+    std::vector<Exs_MappingInfo> mappings;
+    std::vector<std::string> paths;
+    bool walked = Exs_WriteFile(path, smaps) && Exs_ForEachMappingInFile(path, [&](const Exs_MappingInfo& mapping) {
+        mappings.push_back(mapping);
+        paths.push_back(mapping.path);
+    });
+    bool headerOk = walked && mappings.size() == 2 && mappings[0].start == 0x400000 && mappings[0].end == 0x452000 &&
+                    strcmp(mappings[0].permissions, "r-xp") == 0 && mappings[0].offset == 0x1000 &&
+                    mappings[0].inode == 173521 && paths[0] == "/usr/lib/my lib.so" && paths[1] == "[stack]";
+    bool countersOk = headerOk && mappings[0].kernelPageSizeBytes == 4096 &&
+                      mappings[0].counters.rss == 300 * 1024 && mappings[0].counters.pss == 150 * 1024 &&
+                      mappings[0].counters.sharedClean == 200 * 1024 && mappings[0].counters.privateDirty == 100 * 1024 &&
+                      mappings[0].counters.hugetlb == 4096 * 1024 &&
+                      mappings[1].counters.rss == 4096 && mappings[1].counters.anonymous == 4096;
+    if (countersOk) {
+        std::cout << "✓ Headers and counters of 2 mappings\n";
+        passed++;
+    } else {
+        std::cout << "✗ smaps misparsed (" << mappings.size() << " mappings)\n";
+    }
+
+    // Test 2: Lines split across buffer refills are reassembled
+    total++;
+    std::string large;
+    const uint64_t count = 5000;
+    for (uint64_t i = 0; i < count; i++) {
+        char header[160];
+        snprintf(header, sizeof(header), "%llx-%llx rw-p 00000000 00:00 0                          /lib/m%llu.so\n",
+                 static_cast<unsigned long long>(0x10000000 + i * 0x1000),
+                 static_cast<unsigned long long>(0x10001000 + i * 0x1000), static_cast<unsigned long long>(i));
+        large += header;
+        large += "Rss:                   4 kB\nPss:                   2 kB\n";
+    }
+    uint64_t visited = 0, rss = 0, pss = 0;
+    bool inOrder = true;
+    bool largeOk = Exs_WriteFile(path, large) && Exs_ForEachMappingInFile(path, [&](const Exs_MappingInfo& mapping) {
+        inOrder = inOrder && mapping.start == 0x10000000 + visited * 0x1000 &&
+                  std::string(mapping.path) == "/lib/m" + std::to_string(visited) + ".so";
+        visited++;
+        rss += mapping.counters.rss;
+        pss += mapping.counters.pss;
+    });
+    if (largeOk && inOrder && visited == count && rss == count * 4096 && pss == count * 2048) {
+        std::cout << "✓ " << visited << " mappings over " << large.size() << " bytes\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << visited << " of " << count << " mappings\n";
+    }
+    unlink(path);
+
+    // Test 3: This process has a stack and resident memory
+    total++;
+    bool hasStack = false;
+    bool ok = Exs_ForEachMapping(0, Exs_MappingDetail::Ranges, [&](const Exs_MappingInfo& mapping) {
+        hasStack = hasStack || strcmp(mapping.path, "[stack]") == 0;
+    });
+    Exs_MappingCounters totals;
+    if (ok && hasStack && Exs_ReadMemoryRollup(0, totals) && totals.rss > 0 && totals.pss <= totals.rss) {
+        std::cout << "✓ Own maps; RSS " << totals.rss / 1024 << " kB\n";
+        passed++;
+    } else {
+        std::cout << "✗ Own maps or rollup unreadable\n";
+    }
+
+    // Test 4: A missing file fails without visiting anything
+    total++;
+    visited = 0;
+    if (!Exs_ForEachMappingInFile("/proc/does-not-exist/smaps", [&](const Exs_MappingInfo&) { visited++; }) &&
+        visited == 0) {
+        std::cout << "✓ Missing file rejected\n";
+        passed++;
+    } else {
+        std::cout << "✗ Missing file accepted\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/ThermalSensors.h"
+#include "../../src/Core/Platform/Linux/SysfsLinux.h"
+
+using namespace Exs::Internal::CPUInfo;
+using Exs::Internal::Platform::Exs_GetOnlineCPUs;
+using Exs::Internal::Platform::Exs_ListDirectory;
+
+static Exs_ThermalSensorInfo Exs_Classify(const char* label) {
+    Exs_ThermalSensorInfo info = {};
+    info.label = label;
+    info.packageId = 7;
+    info.coreId = 9;
+    Exs_ClassifyThermalLabel(info);
+    return info;
+}
+
+int main() {
+    std::cout << "=== Exs Thermal Sensors Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: coretemp labels carry their package and core ids
+    total++;
+    Exs_ThermalSensorInfo package = Exs_Classify("Package id 1");
+    Exs_ThermalSensorInfo core = Exs_Classify("Core 12");
+    if (package.kind == Exs_ThermalSensorKind::Package && package.packageId == 1 &&
+        core.kind == Exs_ThermalSensorKind::Core && core.coreId == 12 && core.packageId == 7) {
+        std::cout << "✓ coretemp labels\n";
+        passed++;
+    } else {
+        std::cout << "✗ coretemp labels misclassified\n";
+    }
+
+    // Test 2: k10temp labels keep the instance's package
+    total++;
+    Exs_ThermalSensorInfo tctl = Exs_Classify("Tctl");
+    Exs_ThermalSensorInfo tdie = Exs_Classify("Tdie");
+    Exs_ThermalSensorInfo ccd = Exs_Classify("Tccd3");
+    Exs_ThermalSensorInfo other = Exs_Classify("temp5");
+    if (tctl.kind == Exs_ThermalSensorKind::Package && tctl.packageId == 7 &&
+        tdie.kind == Exs_ThermalSensorKind::Package && ccd.kind == Exs_ThermalSensorKind::Die &&
+        ccd.packageId == 7 && other.kind == Exs_ThermalSensorKind::Other) {
+        std::cout << "✓ k10temp labels\n";
+        passed++;
+    } else {
+        std::cout << "✗ k10temp labels misclassified\n";
+    }
+
+    // Test 3: Directory entries come in natural order, parents before subzones
+    total++;
+    char directory[] = "/tmp/exs_thermal_XXXXXX";
+    bool listed = false;
+    if (mkdtemp(directory) != nullptr) {
+        const char* names[] = { "hwmon10", "hwmon9", "hwmon0", "intel-rapl:0:1", "intel-rapl:1",
+                                "intel-rapl:0", "intel-rapl:0:0", "other" };
+        for (const char* name : names) {
+            close(open((std::string(directory) + "/" + name).c_str(), O_CREAT | O_WRONLY, 0600));
+        }
+        std::vector<std::string> hwmon = Exs_ListDirectory(directory, "hwmon");
+        std::vector<std::string> rapl = Exs_ListDirectory(directory, "intel-rapl:");
+        listed = hwmon == std::vector<std::string>{ "hwmon0", "hwmon9", "hwmon10" } &&
+                 rapl == std::vector<std::string>{ "intel-rapl:0", "intel-rapl:0:0", "intel-rapl:0:1", "intel-rapl:1" } &&
+                 Exs_ListDirectory("/nonexistent", "hwmon").empty();
+        for (const char* name : names) {
+            unlink((std::string(directory) + "/" + name).c_str());
+        }
+        rmdir(directory);
+    }
+    if (listed) {
+        std::cout << "✓ Directory entries in natural order\n";
+        passed++;
+    } else {
+        std::cout << "✗ Directory entries out of order\n";
+    }
+
+    // Test 4: Live inputs read in a plausible range and CPUs map to existing ones
+    total++;
+    Exs_ThermalSensors sensors;
+    std::vector<uint32_t> cpus = Exs_GetOnlineCPUs();
+    std::vector<int32_t> values;
+    bool haveInputs = !sensors.getSensors().empty();
+    bool plausible = sensors.readAll(values) == haveInputs && values.size() == sensors.getSensors().size();
+    for (int32_t value : values) {
+        plausible = plausible && (value == INT32_MIN || (value > -40000 && value < 150000));
+    }
+    bool mapped = sensors.getSensorForCPU(UINT32_MAX) == -1;
+    for (uint32_t cpu : cpus) {
+        int32_t sensor = sensors.getSensorForCPU(cpu);
+        mapped = mapped && sensor >= -1 && sensor < static_cast<int32_t>(sensors.getSensors().size());
+    }
+    if (plausible && mapped && sensors.readCPUTemperatures(cpus).size() == cpus.size()) {
+        std::cout << "✓ " << values.size() << " inputs, hottest package "
+                  << sensors.readHottestPackage() << " C\n";
+        passed++;
+    } else {
+        std::cout << "✗ Live inputs out of range or mapped to a missing sensor\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <atomic>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/ThreadPool.h"
+
+using namespace Exs::Internal::Platform;
+
+int main() {
+    std::cout << "=== Exs Thread Pool Test ===\n\n";
+
+    // A deadlock fails the test instead of hanging it
+    alarm(60);
+
+    int passed = 0;
+    int total = 0;
+
+    Exs_ThreadPoolOptions options;
+    options.pinning = Exs_ThreadPinningPolicy::None;
+    options.workerCount = 4;
+    Exs_ThreadPool pool(options);
+
+    // Test 1: Every index visited exactly once
+    total++;
+    std::atomic<uint64_t> sum{0};
+    pool.parallelFor(0, 10000, 7, [&sum](uint64_t begin, uint64_t end) {
+        for (uint64_t i = begin; i < end; i++) {
+            sum.fetch_add(i);
+        }
+    });
+    if (sum.load() == 10000ULL * 9999ULL / 2) {
+        std::cout << "✓ parallelFor covered the range\n";
+        passed++;
+    } else {
+        std::cout << "✗ parallelFor sum " << sum.load() << "\n";
+    }
+
+    // Test 2: Many short parallelFor calls; the caller returns while the
+    // last chunk may still be signalling completion
+    total++;
+    std::atomic<uint64_t> chunks{0};
+    for (int round = 0; round < 2000; round++) {
+        pool.parallelFor(0, 4, 1, [&chunks](uint64_t, uint64_t) { chunks.fetch_add(1); });
+    }
+    if (chunks.load() == 8000) {
+        std::cout << "✓ Repeated parallelFor completed\n";
+        passed++;
+    } else {
+        std::cout << "✗ Repeated parallelFor ran " << chunks.load() << " chunks\n";
+    }
+
+    // Test 3: parallelFor nested inside pool tasks
+    total++;
+    std::atomic<uint64_t> nested{0};
+    pool.parallelFor(0, 8, 1, [&](uint64_t, uint64_t) {
+        pool.parallelFor(0, 100, 10, [&nested](uint64_t begin, uint64_t end) {
+            nested.fetch_add(end - begin);
+        });
+    });
+    if (nested.load() == 800) {
+        std::cout << "✓ Nested parallelFor completed\n";
+        passed++;
+    } else {
+        std::cout << "✗ Nested parallelFor counted " << nested.load() << "\n";
+    }
+
+    // Test 4: Several tasks in waitIdle() at once do not wait on each other
+    total++;
+    std::atomic<int> waiters{0};
+    std::atomic<int> work{0};
+    for (int i = 0; i < 4; i++) {
+        pool.submit([&]() {
+            for (int j = 0; j < 16; j++) {
+                pool.submit([&work]() { work.fetch_add(1); });
+            }
+            pool.waitIdle();
+            waiters.fetch_add(1);
+        });
+    }
+    pool.waitIdle();
+    if (waiters.load() == 4 && work.load() == 64) {
+        std::cout << "✓ Concurrent waitIdle() from tasks returned\n";
+        passed++;
+    } else {
+        std::cout << "✗ waitIdle(): " << waiters.load() << " waiters, " << work.load() << " tasks\n";
+    }
+
+    // Test 5: Worker index only inside the pool
+    total++;
+    std::atomic<int> insideIndex{-1};
+    pool.submit([&]() { insideIndex.store(pool.getCurrentWorkerIndex()); });
+    pool.waitIdle();
+    if (pool.getCurrentWorkerIndex() == -1 && insideIndex.load() >= 0 &&
+        insideIndex.load() < static_cast<int>(pool.getWorkerCount())) {
+        std::cout << "✓ Worker index: " << insideIndex.load() << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Worker index " << insideIndex.load() << "\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../../src/Core/Platform/internal/ThreadRegistry.h"
+
+using namespace Exs::Internal::Platform;
+
+int main() {
+    std::cout << "=== Exs Thread Registry Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: The cached id is the kernel thread id, also in other threads
+    total++;
+    uint32_t mainId = Exs_GetOSThreadId();
+    uint32_t workerId = 0;
+    uint32_t workerKernelId = 1;
+    std::thread([&]() {
+        workerId = Exs_GetOSThreadId();
+        workerKernelId = static_cast<uint32_t>(syscall(SYS_gettid));
+    }).join();
+    if (mainId == static_cast<uint32_t>(syscall(SYS_gettid)) && workerId == workerKernelId && workerId != mainId) {
+        std::cout << "✓ Thread ids " << mainId << ", " << workerId << "\n";
+        passed++;
+    } else {
+        std::cout << "✗ Cached thread id differs from gettid()\n";
+    }
+
+    // Test 2: The id is refreshed in a forked child
+    total++;
+    int pipeFds[2];
+    bool forkOk = false;
+    if (pipe(pipeFds) == 0) {
+        pid_t child = fork();
+        if (child == 0) {
+            uint32_t ids[2] = { Exs_GetOSThreadId(), static_cast<uint32_t>(syscall(SYS_gettid)) };
+            ssize_t written = write(pipeFds[1], ids, sizeof(ids));
+            _exit(written == sizeof(ids) ? 0 : 1);
+        }
+        uint32_t ids[2] = { 0, 1 };
+        ssize_t received = read(pipeFds[0], ids, sizeof(ids));
+        int status = 0;
+        waitpid(child, &status, 0);
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        forkOk = received == sizeof(ids) && ids[0] == ids[1] && ids[0] != mainId;
+    }
+    if (forkOk) {
+        std::cout << "✓ Child sees its own thread id\n";
+        passed++;
+    } else {
+        std::cout << "✗ Child kept the parent's thread id\n";
+    }
+
+    // Test 3: Registration is visible with name, role and affinity
+    total++;
+    Exs_ThreadRecord record;
+    bool registered = Exs_RegisterCurrentThread("main-thread", "test") && Exs_LookupThread(mainId, record);
+    if (registered && strcmp(record.name, "main-thread") == 0 && strcmp(record.role, "test") == 0 &&
+        record.affinityCPUCount > 0) {
+        std::cout << "✓ Registered on " << record.affinityCPUCount << " CPUs\n";
+        passed++;
+    } else {
+        std::cout << "✗ Registration not visible\n";
+    }
+
+    // Test 4: Threads leave the registry when they exit, even under concurrent readers
+    total++;
+    std::atomic<bool> reading{true};
+    std::thread reader([&]() {
+        while (reading.load()) {
+            Exs_SnapshotThreadRegistry();
+        }
+    });
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 8; i++) {
+        workers.emplace_back([]() {
+            Exs_RegisterCurrentThread("worker", "pool");
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    reading.store(false);
+    reader.join();
+    std::vector<Exs_ThreadRecord> snapshot = Exs_SnapshotThreadRegistry();
+    bool onlyMain = snapshot.size() == 1 && snapshot[0].threadId == mainId;
+    if (onlyMain) {
+        std::cout << "✓ Exited threads released their slots\n";
+        passed++;
+    } else {
+        std::cout << "✗ " << snapshot.size() << " threads still registered\n";
+    }
+
+    // Test 5: Unregistering removes the caller
+    total++;
+    Exs_UnregisterCurrentThread();
+    if (!Exs_LookupThread(mainId, record) && Exs_SnapshotThreadRegistry().empty()) {
+        std::cout << "✓ Unregistered\n";
+        passed++;
+    } else {
+        std::cout << "✗ Thread still registered\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright [2024] [DSRT-Docs]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <iostream>
+#include <memory>
+#include "../../src/Core/Platform/internal/TopologyTree.h"
+
+using namespace Exs::Internal::CPUInfo;
+
+static Exs_TopologyNode Exs_MakeNode(Exs_TopologyNodeType type, uint32 id, std::vector<uint32> cpus) {
+    Exs_TopologyNode node = {};
+    node.type = type;
+    node.id = id;
+    node.coreType = Exs_CPUCoreType::Unknown;
+    node.cpus = std::move(cpus);
+    return node;
+}
+
+int main() {
+    std::cout << "=== Exs Topology Tree Test ===\n\n";
+
+    int passed = 0;
+    int total = 0;
+
+    // Test 1: CPU lists collapse runs into ranges
+    total++;
+    if (Exs_FormatCPUList({}) == "" && Exs_FormatCPUList({ 5 }) == "5" &&
+        Exs_FormatCPUList({ 0, 1 }) == "0-1" && Exs_FormatCPUList({ 0, 1, 2, 3, 8, 10, 11 }) == "0-3,8,10-11" &&
+        Exs_FormatCPUList({ 1, 3, 5 }) == "1,3,5") {
+        std::cout << "✓ CPU list formatting\n";
+        passed++;
+    } else {
+        std::cout << "✗ CPU list formatted as \"" << Exs_FormatCPUList({ 0, 1, 2, 3, 8, 10, 11 }) << "\"\n";
+    }
+
+    // Test 2: JSON of a hand-built tree
+    total++;
+    Exs_TopologyNode l2 = Exs_MakeNode(Exs_TopologyNodeType::L2Cache, 0, { 0, 1 });
+    l2.sizeKB = 1024;
+    Exs_TopologyNode core = Exs_MakeNode(Exs_TopologyNodeType::Core, 0, { 0, 1 });
+    core.coreType = Exs_CPUCoreType::Performance;
+    core.children.push_back(Exs_MakeNode(Exs_TopologyNodeType::PU, 0, { 0 }));
+    core.children.push_back(Exs_MakeNode(Exs_TopologyNodeType::PU, 1, { 1 }));
+    l2.children.push_back(core);
+    std::string json = Exs_TopologyToJSON(l2);
+    std::string expected =
+        "{\"type\":\"l2\",\"id\":0,\"cpus\":\"0-1\",\"size_kb\":1024,\"children\":["
+        "{\"type\":\"core\",\"id\":0,\"cpus\":\"0-1\",\"core_type\":\"performance\",\"children\":["
+        "{\"type\":\"pu\",\"id\":0},{\"type\":\"pu\",\"id\":1}]}]}";
+    if (json == expected) {
+        std::cout << "✓ JSON serialization\n";
+        passed++;
+    } else {
+        std::cout << "✗ JSON: " << json << "\n";
+    }
+
+    // Test 3: The machine tree reaches every online CPU, and the cached JSON matches it
+    total++;
+    const Exs_TopologyNode& tree = Exs_GetTopologyTree();
+    std::vector<const Exs_TopologyNode*> pus = Exs_GetTopologyNodes(tree, Exs_TopologyNodeType::PU);
+    bool covered = tree.type == Exs_TopologyNodeType::Machine && !tree.cpus.empty();
+    for (uint32 cpu : tree.cpus) {
+        uint32 count = 0;
+        for (const Exs_TopologyNode* pu : pus) {
+            count += pu->id == cpu ? 1 : 0;
+        }
+        covered = covered && count >= 1;
+    }
+    if (covered && Exs_GetTopologyJSON() == Exs_TopologyToJSON(tree)) {
+        std::cout << "✓ Machine tree: " << tree.cpus.size() << " CPUs\n";
+        passed++;
+    } else {
+        std::cout << "✗ Machine tree incomplete\n";
+    }
+
+    // Test 4: The topology string stays readable text; JSON has its own accessor
+    total++;
+    std::unique_ptr<Exs_CPUInfoBase> info(Exs_CreateCPUInfoInstance());
+    std::string text = info->getTopologyString();
+    if (text.compare(0, 16, "Physical Cores: ") == 0 && info->getTopologyJSON() == Exs_GetTopologyJSON()) {
+        std::cout << "✓ Text and JSON accessors\n";
+        passed++;
+    } else {
+        std::cout << "✗ Topology string: " << text.substr(0, 40) << "\n";
+    }
+
+    std::cout << "\n=== Results: " << passed << "/" << total << " passed ===\n";
+    return (passed == total) ? 0 : 1;
+}